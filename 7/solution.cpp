@@ -1,14 +1,34 @@
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
 #include <cassert>
+#include <charconv>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <fstream>
 #include <functional>
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <optional>
-#include <ranges>
+#include <span>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "frozen/string.h"
@@ -24,6 +44,15 @@ namespace std {
 }
 }  // namespace std
 
+// Pops the next space-separated word off the front of `text`
+std::string_view next_word(std::string_view& text) {
+  const std::size_t begin = std::min(text.find_first_not_of(' '), text.size());
+  const std::size_t end = std::min(text.find(' ', begin), text.size());
+  const std::string_view word = text.substr(begin, end - begin);
+  text.remove_prefix(end);
+  return word;
+}
+
 class Command {
  public:
   const static constexpr std::string_view prefix{"$"};
@@ -31,47 +60,49 @@ class Command {
   enum class Type {
     cd,
     ls,
+    du,
+    find,
+    rm,
+    mv,
+    touch,
+    // Anything else, e.g. `cat` or `pwd`, which leaves the tree alone
+    unknown,
   };
 
-  constexpr static frozen::unordered_map<frozen::string, Type, 2> str_to_type{
-      {"cd", Type::cd},
-      {"ls", Type::ls},
+  constexpr static frozen::unordered_map<frozen::string, Type, 7> str_to_type{
+      {"cd", Type::cd}, {"ls", Type::ls}, {"du", Type::du},
+      {"find", Type::find}, {"rm", Type::rm}, {"mv", Type::mv},
+      {"touch", Type::touch},
   };
 
-  constexpr static frozen::unordered_map<Type, frozen::string, 2> type_to_str{
-      {Type::cd, "cd"},
-      {Type::ls, "ls"},
+  constexpr static frozen::unordered_map<Type, frozen::string, 8> type_to_str{
+      {Type::cd, "cd"},       {Type::ls, "ls"}, {Type::du, "du"},
+      {Type::find, "find"},   {Type::rm, "rm"}, {Type::mv, "mv"},
+      {Type::touch, "touch"}, {Type::unknown, "unknown"},
   };
 
-  Command(const std::vector<std::string>& command_info) {
-    // Simple situation: characters [2, 4) are always the types
-    const auto cmd_line = command_info.front();
-    std::string type_str = cmd_line.substr(2, 2);
-    type_ = str_to_type.at(frozen::string(type_str));
-
-    switch (type_) {
-      case Type::cd:
-        // For cd, characters [5, size()) always form the argument
-        argument_ = cmd_line.substr(5);
-        break;
-      case Type::ls:
-        // For ls, all remainder lines are output, so copy those out
-        std::copy(std::next(command_info.cbegin()), command_info.cend(),
-                  std::back_insert_iterator(output_));
-        break;
-      default:
-        std::unreachable();
+  explicit Command(const std::string_view cmd_line) {
+    // The first word after the prefix is always the type, and whatever
+    // follows it is the argument
+    std::string_view rest = cmd_line.substr(prefix.length());
+    const auto type = str_to_type.find(frozen::string{next_word(rest)});
+    type_ = type != str_to_type.end() ? type->second : Type::unknown;
+    if (const std::string_view argument = rest.substr(std::min(
+            rest.find_first_not_of(' '), rest.size()));
+        !argument.empty()) {
+      argument_ = argument;
     }
   }
 
   Type type() const { return type_; }
-  const std::optional<std::string>& maybe_argument() const { return argument_; }
-  const std::vector<std::string>& output() const { return output_; }
+  const std::optional<std::string_view>& maybe_argument() const {
+    return argument_;
+  }
 
  private:
   Type type_;
-  std::optional<std::string> argument_{};
-  std::vector<std::string> output_{};
+  // Views into the transcript buffer, which outlives the command
+  std::optional<std::string_view> argument_{};
 };
 
 std::ostream& operator<<(std::ostream& os, const frozen::string& frozen_str) {
@@ -81,41 +112,154 @@ std::ostream& operator<<(std::ostream& os, const frozen::string& frozen_str) {
 }
 
 std::ostream& operator<<(std::ostream& os, const Command& command) {
-  os << Command::type_to_str.at(command.type()) << ": ";
-  switch (command.type()) {
-    case Command::Type::cd:
-      os << command.maybe_argument().value_or("");
-      break;
-    case Command::Type::ls:
-      std::copy(command.output().cbegin(), command.output().cend(),
-                std::ostream_iterator<std::string>(os, "\n"));
-      break;
-    default:
-      std::unreachable();
-  }
+  os << Command::type_to_str.at(command.type()) << ": "
+     << command.maybe_argument().value_or("");
   return os;
 }
 
+class MappedFile {
+ public:
+  explicit MappedFile(const char* path) {
+    const int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+      return;
+    }
+    struct stat file_stat;
+    if (::fstat(fd, &file_stat) == 0 && file_stat.st_size > 0) {
+      void* const data = ::mmap(nullptr, file_stat.st_size, PROT_READ,
+                                MAP_PRIVATE, fd, 0);
+      if (data != MAP_FAILED) {
+        data_ = static_cast<const char*>(data);
+        size_ = file_stat.st_size;
+      }
+    }
+    ::close(fd);
+  }
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  ~MappedFile() {
+    if (is_open()) {
+      ::munmap(const_cast<char*>(data_), size_);
+    }
+  }
+
+  bool is_open() const { return data_ != nullptr; }
+  std::string_view contents() const { return {data_, size_}; }
+
+ private:
+  const char* data_{nullptr};
+  std::size_t size_{};
+};
+
+// Interns names into a single byte arena and hands out dense 32-bit IDs, so
+// that duplicate names share storage and comparing names is an integer compare
+class NamePool {
+ public:
+  using Id = std::uint32_t;
+
+  Id intern(const std::string_view name) {
+    if (2 * (size() + 1) > slots_.size()) {
+      grow();
+    }
+    std::size_t slot = find_slot(name);
+    if (slots_[slot] == empty_slot) {
+      const Id id = static_cast<Id>(size());
+      arena_.insert(arena_.end(), name.cbegin(), name.cend());
+      offsets_.push_back(static_cast<std::uint32_t>(arena_.size()));
+      slots_[slot] = id;
+    }
+    return slots_[slot];
+  }
+
+  std::optional<Id> find(const std::string_view name) const {
+    if (slots_.empty() || slots_[find_slot(name)] == empty_slot) {
+      return {};
+    }
+    return slots_[find_slot(name)];
+  }
+
+  std::string_view name(const Id id) const {
+    return {arena_.data() + offsets_[id], offsets_[id + 1] - offsets_[id]};
+  }
+
+  std::size_t size() const { return offsets_.size() - 1; }
+  std::string_view bytes() const { return {arena_.data(), arena_.size()}; }
+  // Start of each name in `bytes()`, followed by the end of the last one
+  const std::vector<std::uint32_t>& offsets() const { return offsets_; }
+
+ private:
+  static constexpr const Id empty_slot = std::numeric_limits<Id>::max();
+
+  // Open addressing with linear probing; slots hold IDs, so the arena is free
+  // to reallocate without invalidating the table
+  std::size_t find_slot(const std::string_view name) const {
+    const std::size_t mask = slots_.size() - 1;
+    std::size_t slot = std::hash<std::string_view>{}(name) & mask;
+    while (slots_[slot] != empty_slot && this->name(slots_[slot]) != name) {
+      slot = (slot + 1) & mask;
+    }
+    return slot;
+  }
+
+  void grow() {
+    slots_.assign(std::max<std::size_t>(16, 2 * slots_.size()), empty_slot);
+    for (Id id{}; id < size(); ++id) {
+      slots_[find_slot(name(id))] = id;
+    }
+  }
+
+  std::vector<char> arena_{};
+  std::vector<std::uint32_t> offsets_{0};
+  std::vector<Id> slots_{};
+};
+
 struct File {
-  std::string name;
-  std::size_t size;
+  NamePool::Id name;
+  std::uint64_t size;
 };
 
 class Directory {
  public:
-  Directory(const std::string& name) : name_{name} {}
-  std::size_t size() const {
-    return std::accumulate(files_.cbegin(), files_.cend(), 0,
-                           [](const std::size_t init, const auto& file) {
-                             return init + file->size;
-                           }) +
-           std::accumulate(child_dirs_.cbegin(), child_dirs_.cend(), 0,
-                           [](const std::size_t init, const auto child_dir) {
-                             return init + child_dir->size();
-                           });
-  }
-  std::string name() const { return name_; }
-  std::shared_ptr<Directory> parent() const { return parent_; }
+  Directory(const NamePool::Id name, const std::uint32_t index)
+      : name_{name}, index_{index} {}
+  Directory(const Directory&) = delete;
+  Directory& operator=(const Directory&) = delete;
+  // Tears the subtree down iteratively, as recursive destruction of a deep
+  // chain would overflow the stack
+  ~Directory() {
+    std::vector<std::shared_ptr<Directory>> pending = std::move(child_dirs_);
+    while (!pending.empty()) {
+      const auto dir = std::move(pending.back());
+      pending.pop_back();
+      if (dir.use_count() == 1) {
+        std::move(dir->child_dirs_.begin(), dir->child_dirs_.end(),
+                  std::back_inserter(pending));
+        dir->child_dirs_.clear();
+      }
+    }
+  }
+
+  std::uint64_t size() const {
+    std::uint64_t size{};
+    std::vector<const Directory*> pending{this};
+    while (!pending.empty()) {
+      const Directory* const dir = pending.back();
+      pending.pop_back();
+      for (const auto& file : dir->files_) {
+        size += file->size;
+      }
+      for (const auto& child_dir : dir->child_dirs_) {
+        pending.push_back(child_dir.get());
+      }
+    }
+    return size;
+  }
+  NamePool::Id name() const { return name_; }
+  // Position among all directories, where parents always precede their
+  // children. Creation order at first, breadth-first once `rm` or `mv` have
+  // reshaped the tree.
+  std::uint32_t index() const { return index_; }
+  Directory* parent() const { return parent_; }
   std::vector<std::shared_ptr<Directory>>& child_dirs() { return child_dirs_; }
   const std::vector<std::shared_ptr<Directory>>& child_dirs() const {
     return child_dirs_;
@@ -123,111 +267,1527 @@ class Directory {
   std::vector<std::unique_ptr<File>>& files() { return files_; }
   const std::vector<std::unique_ptr<File>>& files() const { return files_; }
 
-  void set_parent(std::shared_ptr<Directory> parent) { parent_ = parent; }
+  // Whether an `ls` of this directory has been seen
+  bool listed() const { return listed_; }
+  void set_listed() { listed_ = true; }
+  void set_name(const NamePool::Id name) { name_ = name; }
+  void set_index(const std::uint32_t index) { index_ = index; }
+  void set_parent(Directory* parent) { parent_ = parent; }
 
  private:
-  std::string name_;
-  std::shared_ptr<Directory> parent_{nullptr};
+  NamePool::Id name_;
+  std::uint32_t index_;
+  // Non-owning, so that parent and child don't keep each other alive
+  Directory* parent_{nullptr};
   std::vector<std::shared_ptr<Directory>> child_dirs_{};
   std::vector<std::unique_ptr<File>> files_{};
+  bool listed_{false};
 };
 
+// Prints the tree in the same `- name (dir)` layout the puzzle uses
+void print_tree(std::ostream& os, const Directory& root,
+                const NamePool& names) {
+  struct Frame {
+    const Directory* dir;
+    std::size_t depth;
+    // Set once the directory's line and children have been emitted, leaving
+    // only its files
+    bool expanded;
+  };
+  std::vector<Frame> pending{{&root, 0, false}};
+  while (!pending.empty()) {
+    const Frame frame = pending.back();
+    pending.pop_back();
+    const std::string indent(2 * frame.depth, ' ');
+    if (frame.expanded) {
+      for (const auto& file : frame.dir->files()) {
+        os << indent << "  - " << names.name(file->name)
+           << " (file, size=" << file->size << ")\n";
+      }
+      continue;
+    }
+    os << indent << "- " << names.name(frame.dir->name()) << " (dir)\n";
+    pending.push_back({frame.dir, frame.depth, true});
+    const auto& child_dirs = frame.dir->child_dirs();
+    for (auto it = child_dirs.crbegin(); it != child_dirs.crend(); ++it) {
+      pending.push_back({it->get(), frame.depth + 1, false});
+    }
+  }
+}
+
 constexpr const std::size_t dir_size_limit = 100000;
 constexpr const std::size_t filesystem_space = 70000000;
 constexpr const std::size_t unused_space = 30000000;
 
-std::vector<std::size_t> find_dir_sizes_around_limit(
-    const Directory* root, const std::size_t dir_size_limit,
-    std::function<bool(const std::size_t, const std::size_t)> cmp) {
-  std::vector<std::size_t> dir_sizes;
-  if (cmp(root->size(), dir_size_limit)) {
-    dir_sizes.push_back(root->size());
+// Computes the size of `dir` and every directory below it, storing each at
+// its index in `dir_sizes`. Directories are listed breadth-first and then
+// folded up in reverse, so every child is done before its parent.
+std::uint64_t collect_dir_sizes(const Directory& dir,
+                                std::vector<std::uint64_t>& dir_sizes) {
+  std::vector<const Directory*> order{&dir};
+  for (std::size_t index{}; index < order.size(); ++index) {
+    for (const auto& child_dir : order[index]->child_dirs()) {
+      order.push_back(child_dir.get());
+    }
   }
-  for (const auto& child : root->child_dirs()) {
-    std::vector<std::size_t> child_large_dir_sizes =
-        find_dir_sizes_around_limit(child.get(), dir_size_limit, cmp);
-    dir_sizes.insert(dir_sizes.end(), child_large_dir_sizes.begin(),
-                     child_large_dir_sizes.end());
+  for (auto it = order.crbegin(); it != order.crend(); ++it) {
+    std::uint64_t size{};
+    for (const auto& file : (*it)->files()) {
+      size += file->size;
+    }
+    for (const auto& child_dir : (*it)->child_dirs()) {
+      size += dir_sizes[child_dir->index()];
+    }
+    dir_sizes[(*it)->index()] = size;
   }
-  return dir_sizes;
+  return dir_sizes[dir.index()];
 }
 
-int main() {
-  std::vector<Command> commands;
-  if (std::ifstream ifs{"input"}; ifs.is_open()) {
-    std::vector<std::string> command_info;
-    for (std::string line; std::getline(ifs, line);) {
-      // Start of a command
-      if (line.starts_with(Command::prefix)) {
-        if (!command_info.empty()) {
-          commands.emplace_back(command_info);
+// Directory sizes in ascending order alongside their prefix sums, so that
+// threshold queries are a binary search away. The index either owns its
+// arrays or views ones that live elsewhere, such as in a mapped snapshot.
+class SizeIndex {
+ public:
+  explicit SizeIndex(const std::vector<std::uint64_t>& dir_sizes)
+      : storage_(2 * dir_sizes.size() + 1) {
+    const auto sorted_end = std::next(
+        storage_.begin(), static_cast<std::ptrdiff_t>(dir_sizes.size()));
+    std::copy(dir_sizes.cbegin(), dir_sizes.cend(), storage_.begin());
+    std::sort(storage_.begin(), sorted_end);
+    // storage_[size()] is already the leading 0 of the prefix sums, which
+    // saturate rather than wrap once they pass 16 EiB
+    std::partial_sum(storage_.begin(), sorted_end, std::next(sorted_end),
+                     [](const std::uint64_t total, const std::uint64_t size) {
+                       std::uint64_t sum;
+                       return __builtin_add_overflow(total, size, &sum)
+                                  ? std::numeric_limits<std::uint64_t>::max()
+                                  : sum;
+                     });
+    sorted_ = {storage_.data(), dir_sizes.size()};
+    prefix_sums_ = {storage_.data() + dir_sizes.size(), dir_sizes.size() + 1};
+  }
+  SizeIndex(const std::span<const std::uint64_t> sorted,
+            const std::span<const std::uint64_t> prefix_sums)
+      : sorted_{sorted}, prefix_sums_{prefix_sums} {}
+  // Copies would keep viewing the original's storage
+  SizeIndex(const SizeIndex&) = delete;
+  SizeIndex& operator=(const SizeIndex&) = delete;
+  SizeIndex(SizeIndex&&) = default;
+  SizeIndex& operator=(SizeIndex&&) = default;
+
+  std::size_t size() const { return sorted_.size(); }
+  std::span<const std::uint64_t> sorted() const { return sorted_; }
+  std::span<const std::uint64_t> prefix_sums() const { return prefix_sums_; }
+
+  // Sum of all sizes <= limit
+  std::uint64_t total_at_most(const std::uint64_t limit) const {
+    return prefix_sums_[count_at_most(limit)];
+  }
+
+  // Smallest size >= limit
+  std::optional<std::uint64_t> smallest_at_least(
+      const std::uint64_t limit) const {
+    const auto it = std::lower_bound(sorted_.begin(), sorted_.end(), limit);
+    if (it == sorted_.end()) {
+      return {};
+    }
+    return *it;
+  }
+
+  // Number of sizes in [lower, upper]
+  std::size_t count_between(const std::uint64_t lower,
+                            const std::uint64_t upper) const {
+    if (lower > upper) {
+      return 0;
+    }
+    return count_at_most(upper) - count_less_than(lower);
+  }
+
+  // k-th largest size, with k = 1 being the largest
+  std::optional<std::uint64_t> kth_largest(const std::size_t k) const {
+    if (k == 0 || k > sorted_.size()) {
+      return {};
+    }
+    return sorted_[sorted_.size() - k];
+  }
+
+ private:
+  // Number of sizes < limit
+  std::size_t count_less_than(const std::uint64_t limit) const {
+    return std::distance(
+        sorted_.begin(),
+        std::lower_bound(sorted_.begin(), sorted_.end(), limit));
+  }
+
+  // Number of sizes <= limit
+  std::size_t count_at_most(const std::uint64_t limit) const {
+    return std::distance(
+        sorted_.begin(),
+        std::upper_bound(sorted_.begin(), sorted_.end(), limit));
+  }
+
+  std::vector<std::uint64_t> storage_{};
+  std::span<const std::uint64_t> sorted_;
+  std::span<const std::uint64_t> prefix_sums_;
+};
+
+// Fork-join pool in which each worker owns a deque of tasks: owners push and
+// pop at the back, while idle workers steal from the front of other deques
+class WorkStealingPool {
+ public:
+  using Task = std::function<void()>;
+
+  explicit WorkStealingPool(const std::size_t num_threads)
+      : queues_(std::max<std::size_t>(num_threads, 1)) {
+    // The constructing thread takes part as worker 0 whenever it helps out
+    current_pool_ = this;
+    worker_index_ = 0;
+    for (std::size_t index{1}; index < queues_.size(); ++index) {
+      threads_.emplace_back([this, index] { work(index); });
+    }
+  }
+  WorkStealingPool(const WorkStealingPool&) = delete;
+  WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+  ~WorkStealingPool() {
+    stop_ = true;
+    wake_up_.notify_all();
+    for (auto& thread : threads_) {
+      thread.join();
+    }
+  }
+
+  std::size_t num_threads() const { return queues_.size(); }
+
+  void spawn(Task task) {
+    Queue& queue = queues_[this_worker()];
+    {
+      const std::lock_guard lock{queue.mutex};
+      queue.tasks.push_back(std::move(task));
+    }
+    ++queued_;
+    wake_up_.notify_one();
+  }
+
+  // Runs tasks on the calling thread until `done()` holds
+  template <typename Predicate>
+  void help_until(Predicate done) {
+    const std::size_t index = this_worker();
+    while (!done()) {
+      if (!run_one(index)) {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+ private:
+  struct Queue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  std::size_t this_worker() const {
+    return current_pool_ == this ? worker_index_ : 0;
+  }
+
+  std::optional<Task> take(const std::size_t index) {
+    {
+      Queue& own = queues_[index];
+      const std::lock_guard lock{own.mutex};
+      if (!own.tasks.empty()) {
+        Task task = std::move(own.tasks.back());
+        own.tasks.pop_back();
+        --queued_;
+        return task;
+      }
+    }
+    for (std::size_t offset{1}; offset < queues_.size(); ++offset) {
+      Queue& victim = queues_[(index + offset) % queues_.size()];
+      const std::lock_guard lock{victim.mutex};
+      if (!victim.tasks.empty()) {
+        Task task = std::move(victim.tasks.front());
+        victim.tasks.pop_front();
+        --queued_;
+        return task;
+      }
+    }
+    return {};
+  }
+
+  bool run_one(const std::size_t index) {
+    auto task = take(index);
+    if (!task) {
+      return false;
+    }
+    (*task)();
+    return true;
+  }
+
+  void work(const std::size_t index) {
+    current_pool_ = this;
+    worker_index_ = index;
+    while (!stop_) {
+      if (!run_one(index)) {
+        // Timed, since spawners notify without holding the sleep mutex
+        std::unique_lock lock{sleep_mutex_};
+        wake_up_.wait_for(lock, std::chrono::milliseconds{1},
+                          [this] { return stop_ || queued_ > 0; });
+      }
+    }
+  }
+
+  inline static thread_local const WorkStealingPool* current_pool_{nullptr};
+  inline static thread_local std::size_t worker_index_{};
+
+  std::vector<Queue> queues_;
+  std::vector<std::thread> threads_{};
+  std::atomic<std::size_t> queued_{};
+  std::atomic<bool> stop_{false};
+  std::mutex sleep_mutex_{};
+  std::condition_variable wake_up_{};
+};
+
+// Subtrees with fewer entries than this are summed sequentially by whichever
+// worker reaches them, rather than being split into further tasks
+constexpr const std::size_t parallel_subtree_cutoff = 1 << 14;
+
+// Computes the same per-directory sizes as `collect_dir_sizes`, spawning a
+// task per large subtree. A directory is folded into its parent by whichever
+// thread finishes the last of its large subtrees, so no task ever blocks.
+std::vector<std::uint64_t> collect_dir_sizes_parallel(
+    const std::vector<const Directory*>& dirs, WorkStealingPool& pool,
+    const std::size_t cutoff = parallel_subtree_cutoff) {
+  std::vector<std::uint64_t> dir_sizes(dirs.size());
+  if (dirs.empty()) {
+    return dir_sizes;
+  }
+
+  // Entries in each subtree, accumulated in reverse index order so that
+  // every child is complete before it is added to its parent
+  std::vector<std::size_t> weights(dirs.size());
+  for (std::size_t index{dirs.size()}; index-- > 0;) {
+    weights[index] += 1 + dirs[index]->child_dirs().size() +
+                      dirs[index]->files().size();
+    if (const Directory* const parent = dirs[index]->parent()) {
+      weights[parent->index()] += weights[index];
+    }
+  }
+  const auto is_large = [&weights, cutoff](const auto& dir) {
+    return weights[dir->index()] >= cutoff;
+  };
+
+  // The directory's own task, plus one per large child, must finish
+  std::vector<std::atomic<std::uint32_t>> pending(dirs.size());
+  std::atomic<bool> done{false};
+
+  const auto complete = [&](const Directory* dir) {
+    while (pending[dir->index()].fetch_sub(1, std::memory_order_acq_rel) ==
+           1) {
+      for (const auto& child_dir : dir->child_dirs()) {
+        if (is_large(child_dir)) {
+          dir_sizes[dir->index()] += dir_sizes[child_dir->index()];
+        }
+      }
+      if (dir->parent() == nullptr) {
+        done.store(true, std::memory_order_release);
+        return;
+      }
+      dir = dir->parent();
+    }
+  };
+
+  std::function<void(const Directory*)> aggregate =
+      [&](const Directory* dir) {
+        std::uint32_t num_large{};
+        for (const auto& child_dir : dir->child_dirs()) {
+          num_large += is_large(child_dir);
+        }
+        pending[dir->index()].store(1 + num_large, std::memory_order_relaxed);
+
+        std::uint64_t size{};
+        for (const auto& child_dir : dir->child_dirs()) {
+          if (is_large(child_dir)) {
+            pool.spawn([&aggregate, child = child_dir.get()] {
+              aggregate(child);
+            });
+          }
+        }
+        for (const auto& file : dir->files()) {
+          size += file->size;
         }
-        command_info.clear();
+        for (const auto& child_dir : dir->child_dirs()) {
+          if (!is_large(child_dir)) {
+            size += collect_dir_sizes(*child_dir, dir_sizes);
+          }
+        }
+        dir_sizes[dir->index()] = size;
+        complete(dir);
+      };
+
+  pool.spawn([&aggregate, root = dirs.front()] { aggregate(root); });
+  pool.help_until([&done] { return done.load(std::memory_order_acquire); });
+  return dir_sizes;
+}
+
+constexpr const std::string_view dir_entry_prefix{"dir"};
+constexpr const std::string_view prev_dir_name{".."};
+constexpr const std::string_view root_dir_name{"/"};
+
+// Applies a terminal transcript to a directory tree one line at a time, so
+// nothing but the tree itself outlives the line being read
+class Interpreter {
+ public:
+  Interpreter()
+      : root_{make_dir(names_.intern(root_dir_name))},
+        current_{root_.get()} {}
+
+  void run(const std::string_view transcript) {
+    for (std::size_t begin{}; begin < transcript.size();) {
+      std::size_t end = transcript.find('\n', begin);
+      if (end == std::string_view::npos) {
+        end = transcript.size();
       }
-      command_info.push_back(line);
+      consume(transcript.substr(begin, end - begin));
+      begin = end + 1;
+    }
+    if (needs_reindex_) {
+      reindex();
     }
   }
 
-  constexpr const std::string_view dir_entry_prefix{"dir"};
-  constexpr const std::string_view prev_dir_name{".."};
-  constexpr const std::string_view root_dir_name{"/"};
-  const auto root = std::make_shared<Directory>(
-      commands.cbegin()->maybe_argument().value_or(std::string{root_dir_name}));
-  auto current = root;
-  // Skipping the first command since it is `cd /`, which has been accounted for
-  // in root construction
-  for (const auto& command : commands | std::views::drop(1)) {
+  const std::shared_ptr<Directory>& root() const { return root_; }
+  const NamePool& names() const { return names_; }
+  // Every directory, parents before children, starting with the root
+  const std::vector<const Directory*>& directories() const { return dirs_; }
+
+ private:
+  void consume(const std::string_view line) {
+    if (line.empty()) {
+      return;
+    }
+    if (line.starts_with(Command::prefix)) {
+      listing_ = false;
+      apply(Command{line});
+    } else if (listing_) {
+      // Not a command, so it must be a listing entry from the last `ls`
+      add_entry(line);
+    }
+  }
+
+  std::shared_ptr<Directory> make_dir(const NamePool::Id name) {
+    auto dir = std::make_shared<Directory>(
+        name, static_cast<std::uint32_t>(dirs_.size()));
+    dirs_.push_back(dir.get());
+    return dir;
+  }
+
+  void apply(const Command& command) {
+    std::string_view arguments = command.maybe_argument().value_or("");
     switch (command.type()) {
-      case Command::Type::cd: {
-        const std::string new_dir_name = command.maybe_argument().value();
-        if (new_dir_name == root_dir_name) {
-          current = root;
-        } else if (new_dir_name == prev_dir_name) {
-          current = current->parent();
-        } else {
-          current = *std::find_if(current->child_dirs().begin(),
-                                  current->child_dirs().end(),
-                                  [&new_dir_name](const auto child_dir) {
-                                    return child_dir->name() == new_dir_name;
-                                  });
+      case Command::Type::cd:
+        // Like a shell, stay put when the target doesn't exist
+        if (Directory* const dir = resolve_dir(arguments)) {
+          current_ = dir;
         }
-      } break;
+        break;
       case Command::Type::ls:
-        for (const auto& line : command.output()) {
-          if (line.starts_with(dir_entry_prefix)) {
-            // Dir
-            const std::string dir_name =
-                line.substr(dir_entry_prefix.length() + 1);
-            current->child_dirs().push_back(
-                std::make_shared<Directory>(dir_name));
-            current->child_dirs().back()->set_parent(current);
+        // Entries arrive as the lines that follow. Relisting a directory
+        // must not duplicate what the first listing already added.
+        listing_ = true;
+        relisting_ = current_->listed();
+        current_->set_listed();
+        break;
+      case Command::Type::du:
+      case Command::Type::find:
+      case Command::Type::unknown:
+        // These only report on the tree, so their output is skipped
+        break;
+      case Command::Type::rm: {
+        bool recursive{false};
+        for (std::string_view word = next_word(arguments); !word.empty();
+             word = next_word(arguments)) {
+          if (word.starts_with('-')) {
+            recursive |= word.find_first_of("rR") != std::string_view::npos;
           } else {
-            // File
-            const std::size_t space_idx = line.find(" ");
-            const std::size_t size = std::stoi(line.substr(0, space_idx));
-            const std::string file_name = line.substr(space_idx + 1);
-            current->files().push_back(std::make_unique<File>(file_name, size));
+            remove(word, recursive);
           }
         }
+      } break;
+      case Command::Type::mv: {
+        const std::string_view source = next_word(arguments);
+        const std::string_view target = next_word(arguments);
+        move(source, target);
+      } break;
+      case Command::Type::touch:
+        for (std::string_view word = next_word(arguments); !word.empty();
+             word = next_word(arguments)) {
+          touch(word);
+        }
         break;
       default:
         std::unreachable();
     }
   }
 
-  const auto dir_sizes_under_limit = find_dir_sizes_around_limit(
-      root.get(), dir_size_limit, std::less_equal<std::size_t>{});
-  const std::size_t dir_sizes_sum = std::accumulate(
-      dir_sizes_under_limit.cbegin(), dir_sizes_under_limit.cend(), 0,
-      [](const std::size_t init, const std::size_t dir_size) {
-        return init + dir_size;
-      });
-  std::cout << "Problem 1: " << dir_sizes_sum << '\n';
+  void add_entry(const std::string_view line) {
+    if (line.starts_with(dir_entry_prefix) &&
+        line.substr(dir_entry_prefix.length()).starts_with(' ')) {
+      // Dir
+      const NamePool::Id dir_name =
+          names_.intern(line.substr(dir_entry_prefix.length() + 1));
+      if (relisting_ && find_child_dir(*current_, dir_name) !=
+                            current_->child_dirs().end()) {
+        return;
+      }
+      current_->child_dirs().push_back(make_dir(dir_name));
+      current_->child_dirs().back()->set_parent(current_);
+    } else {
+      // File, as a size and a name. Anything else isn't a listing entry.
+      const std::size_t space_idx = line.find(" ");
+      if (space_idx == std::string_view::npos) {
+        return;
+      }
+      std::uint64_t size{};
+      if (const auto [end, ec] =
+              std::from_chars(line.data(), line.data() + space_idx, size);
+          ec != std::errc{} || end != line.data() + space_idx) {
+        return;
+      }
+      const NamePool::Id file_name = names_.intern(line.substr(space_idx + 1));
+      if (relisting_) {
+        if (const auto file = find_file(*current_, file_name);
+            file != current_->files().end()) {
+          (*file)->size = size;
+          return;
+        }
+      }
+      current_->files().push_back(std::make_unique<File>(file_name, size));
+    }
+  }
 
-  const std::size_t free_req = unused_space - (filesystem_space - root->size());
-  const auto dir_sizes_over_limit = find_dir_sizes_around_limit(
-      root.get(), free_req, std::greater_equal<std::size_t>{});
-  const auto min_biggest_dir_size = *std::min_element(
-      dir_sizes_over_limit.cbegin(), dir_sizes_over_limit.cend());
-  std::cout << "Problem 2: " << min_biggest_dir_size << '\n';
+  void remove(const std::string_view path, const bool recursive) {
+    const auto [parent, maybe_name] = resolve_parent(path);
+    if (parent == nullptr || !maybe_name) {
+      return;
+    }
+    auto& files = parent->files();
+    if (const auto file = find_file(*parent, *maybe_name);
+        file != files.end()) {
+      files.erase(file);
+      return;
+    }
+    auto& child_dirs = parent->child_dirs();
+    const auto dir = find_child_dir(*parent, *maybe_name);
+    if (!recursive || dir == child_dirs.end()) {
+      return;
+    }
+    if (is_within(current_, dir->get())) {
+      current_ = parent;
+    }
+    child_dirs.erase(dir);
+    needs_reindex_ = true;
+  }
+
+  // Moves `source` into `target` when that is an existing directory, and
+  // otherwise moves it to the path `target` names
+  void move(const std::string_view source, const std::string_view target) {
+    const auto [source_parent, maybe_name] = resolve_parent(source);
+    if (source_parent == nullptr || !maybe_name || target.empty()) {
+      return;
+    }
+    Directory* target_parent = resolve_dir(target);
+    NamePool::Id target_name = *maybe_name;
+    if (target_parent == nullptr) {
+      const auto [parent, leaf] = split_parent(target);
+      target_parent = resolve_dir(parent);
+      if (target_parent == nullptr || leaf.empty()) {
+        return;
+      }
+      target_name = names_.intern(leaf);
+    }
+
+    auto& source_files = source_parent->files();
+    if (const auto file = find_file(*source_parent, *maybe_name);
+        file != source_files.end()) {
+      auto moved = std::move(*file);
+      source_files.erase(file);
+      if (const auto existing = find_file(*target_parent, target_name);
+          existing != target_parent->files().end()) {
+        target_parent->files().erase(existing);
+      }
+      moved->name = target_name;
+      target_parent->files().push_back(std::move(moved));
+      return;
+    }
+
+    auto& source_dirs = source_parent->child_dirs();
+    const auto dir = find_child_dir(*source_parent, *maybe_name);
+    // Refuse to clobber a directory or to move one into itself
+    if (dir == source_dirs.end() || is_within(target_parent, dir->get()) ||
+        find_child_dir(*target_parent, target_name) !=
+            target_parent->child_dirs().end()) {
+      return;
+    }
+    auto moved = std::move(*dir);
+    source_dirs.erase(dir);
+    moved->set_name(target_name);
+    moved->set_parent(target_parent);
+    target_parent->child_dirs().push_back(std::move(moved));
+    needs_reindex_ = true;
+  }
+
+  void touch(const std::string_view path) {
+    const auto [parent, leaf] = split_parent(path);
+    Directory* const dir = resolve_dir(parent);
+    if (dir == nullptr || leaf.empty()) {
+      return;
+    }
+    const NamePool::Id name = names_.intern(leaf);
+    if (find_file(*dir, name) == dir->files().end() &&
+        find_child_dir(*dir, name) == dir->child_dirs().end()) {
+      dir->files().push_back(std::make_unique<File>(name, 0));
+    }
+  }
+
+  // Splits `path` into the path of its parent directory and its last
+  // component, with an empty parent meaning the current directory
+  static std::pair<std::string_view, std::string_view> split_parent(
+      std::string_view path) {
+    while (path.size() > root_dir_name.size() && path.ends_with('/')) {
+      path.remove_suffix(1);
+    }
+    const std::size_t slash = path.rfind('/');
+    if (slash == std::string_view::npos) {
+      return {{}, path};
+    }
+    // Keep the leading slash when the parent is the root
+    return {path.substr(0, std::max<std::size_t>(slash, 1)),
+            path.substr(slash + 1)};
+  }
+
+  std::pair<Directory*, std::optional<NamePool::Id>> resolve_parent(
+      const std::string_view path) const {
+    const auto [parent, leaf] = split_parent(path);
+    return {resolve_dir(parent), names_.find(leaf)};
+  }
+
+  Directory* resolve_dir(std::string_view path) const {
+    Directory* dir = path.starts_with('/') ? root_.get() : current_;
+    while (dir != nullptr && !path.empty()) {
+      const std::size_t end = std::min(path.find('/'), path.size());
+      const std::string_view component = path.substr(0, end);
+      path.remove_prefix(std::min(end + 1, path.size()));
+      if (component.empty() || component == ".") {
+        continue;
+      }
+      if (component == prev_dir_name) {
+        // The root is its own parent
+        if (dir->parent() != nullptr) {
+          dir = dir->parent();
+        }
+        continue;
+      }
+      const auto maybe_name = names_.find(component);
+      const auto child_dir = maybe_name
+                                 ? find_child_dir(*dir, *maybe_name)
+                                 : dir->child_dirs().end();
+      dir = child_dir != dir->child_dirs().end() ? child_dir->get() : nullptr;
+    }
+    return dir;
+  }
+
+  static std::vector<std::shared_ptr<Directory>>::iterator find_child_dir(
+      Directory& dir, const NamePool::Id name) {
+    return std::find_if(
+        dir.child_dirs().begin(), dir.child_dirs().end(),
+        [name](const auto& child_dir) { return child_dir->name() == name; });
+  }
+
+  static std::vector<std::unique_ptr<File>>::iterator find_file(
+      Directory& dir, const NamePool::Id name) {
+    return std::find_if(
+        dir.files().begin(), dir.files().end(),
+        [name](const auto& file) { return file->name == name; });
+  }
+
+  static bool is_within(const Directory* dir, const Directory* ancestor) {
+    for (; dir != nullptr; dir = dir->parent()) {
+      if (dir == ancestor) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Renumbers directories breadth-first once removals or moves have broken
+  // the parents-before-children order of creation
+  void reindex() {
+    std::vector<Directory*> order{root_.get()};
+    for (std::size_t index{}; index < order.size(); ++index) {
+      order[index]->set_index(static_cast<std::uint32_t>(index));
+      for (const auto& child_dir : order[index]->child_dirs()) {
+        order.push_back(child_dir.get());
+      }
+    }
+    dirs_.assign(order.cbegin(), order.cend());
+    needs_reindex_ = false;
+  }
+
+  // Declared first, since the root is named out of and registered in these
+  NamePool names_;
+  std::vector<const Directory*> dirs_;
+  std::shared_ptr<Directory> root_;
+  Directory* current_;
+  // Whether lines without the command prefix are `ls` output, and whether
+  // that output is for a directory that was listed before
+  bool listing_{false};
+  bool relisting_{false};
+  bool needs_reindex_{false};
+};
+
+// On-disk image of a parsed filesystem. Every section is an array of
+// fixed-width little-endian records addressed by byte offset from the start of
+// the file, so a mapped snapshot is usable in place wherever it is mapped.
+namespace Snapshot {
+constexpr const std::array<char, 8> magic{'A', 'o', 'C', '7',
+                                          'S', 'N', 'A', 'P'};
+constexpr const std::uint32_t version{1};
+constexpr const std::uint32_t no_parent =
+    std::numeric_limits<std::uint32_t>::max();
+
+struct Header {
+  std::array<char, 8> magic;
+  std::uint32_t version;
+  std::uint32_t num_dirs;
+  std::uint64_t num_files;
+  std::uint64_t num_child_links;
+  std::uint64_t num_names;
+  std::uint64_t name_bytes;
+  // Byte offsets of each section
+  std::uint64_t dirs_offset;
+  std::uint64_t files_offset;
+  std::uint64_t child_links_offset;
+  std::uint64_t name_offsets_offset;
+  std::uint64_t names_offset;
+  std::uint64_t sorted_sizes_offset;
+  std::uint64_t prefix_sums_offset;
+  std::uint64_t total_bytes;
+};
+
+// Directories are stored by index, so parents precede children
+struct DirRecord {
+  std::uint32_t name;
+  std::uint32_t parent;
+  // Ranges into the child link and file tables
+  std::uint64_t first_child_link;
+  std::uint32_t num_child_dirs;
+  std::uint32_t num_files;
+  std::uint64_t first_file;
+  std::uint64_t size;
+};
+
+struct FileRecord {
+  std::uint32_t name;
+  std::uint32_t parent;
+  std::uint64_t size;
+};
+
+static_assert(
+    std::endian::native == std::endian::little,
+    "snapshots are written in host order, which must be little-endian");
+static_assert(std::is_trivially_copyable_v<Header> &&
+              std::is_trivially_copyable_v<DirRecord> &&
+              std::is_trivially_copyable_v<FileRecord>);
+
+constexpr std::uint64_t align_up(const std::uint64_t offset) {
+  constexpr const std::uint64_t alignment{alignof(std::uint64_t)};
+  return (offset + alignment - 1) / alignment * alignment;
+}
+
+template <typename T>
+void write_section(std::ofstream& ofs, const std::uint64_t offset,
+                   const T* data, const std::size_t count) {
+  ofs.seekp(static_cast<std::streamoff>(offset));
+  ofs.write(reinterpret_cast<const char*>(data),
+            static_cast<std::streamsize>(count * sizeof(T)));
+}
+
+// Writes the tree, its names and its precomputed sizes to `path`
+bool save(const char* path, const std::vector<const Directory*>& dirs,
+          const NamePool& names, const std::vector<std::uint64_t>& dir_sizes,
+          const SizeIndex& size_index) {
+  std::vector<DirRecord> dir_records;
+  std::vector<FileRecord> file_records;
+  std::vector<std::uint32_t> child_links;
+  dir_records.reserve(dirs.size());
+  for (const Directory* dir : dirs) {
+    const Directory* const parent = dir->parent();
+    dir_records.push_back({
+        .name = dir->name(),
+        .parent = parent ? parent->index() : no_parent,
+        .first_child_link = child_links.size(),
+        .num_child_dirs = static_cast<std::uint32_t>(dir->child_dirs().size()),
+        .num_files = static_cast<std::uint32_t>(dir->files().size()),
+        .first_file = file_records.size(),
+        .size = dir_sizes[dir->index()],
+    });
+    for (const auto& child_dir : dir->child_dirs()) {
+      child_links.push_back(child_dir->index());
+    }
+    for (const auto& file : dir->files()) {
+      file_records.push_back({file->name, dir->index(), file->size});
+    }
+  }
+
+  Header header{
+      .magic = magic,
+      .version = version,
+      .num_dirs = static_cast<std::uint32_t>(dir_records.size()),
+      .num_files = file_records.size(),
+      .num_child_links = child_links.size(),
+      .num_names = names.size(),
+      .name_bytes = names.bytes().size(),
+  };
+  std::uint64_t offset = align_up(sizeof(Header));
+  const auto place = [&offset](const std::uint64_t bytes) {
+    const std::uint64_t placed = offset;
+    offset = align_up(offset + bytes);
+    return placed;
+  };
+  header.dirs_offset = place(dir_records.size() * sizeof(DirRecord));
+  header.files_offset = place(file_records.size() * sizeof(FileRecord));
+  header.child_links_offset =
+      place(child_links.size() * sizeof(std::uint32_t));
+  header.name_offsets_offset =
+      place(names.offsets().size() * sizeof(std::uint32_t));
+  header.names_offset = place(names.bytes().size());
+  header.sorted_sizes_offset =
+      place(size_index.sorted().size() * sizeof(std::uint64_t));
+  header.prefix_sums_offset =
+      place(size_index.prefix_sums().size() * sizeof(std::uint64_t));
+  header.total_bytes = offset;
+
+  std::ofstream ofs{path, std::ios::binary | std::ios::trunc};
+  if (!ofs.is_open()) {
+    return false;
+  }
+  write_section(ofs, 0, &header, 1);
+  write_section(ofs, header.dirs_offset, dir_records.data(),
+                dir_records.size());
+  write_section(ofs, header.files_offset, file_records.data(),
+                file_records.size());
+  write_section(ofs, header.child_links_offset, child_links.data(),
+                child_links.size());
+  write_section(ofs, header.name_offsets_offset, names.offsets().data(),
+                names.offsets().size());
+  write_section(ofs, header.names_offset, names.bytes().data(),
+                names.bytes().size());
+  write_section(ofs, header.sorted_sizes_offset, size_index.sorted().data(),
+                size_index.sorted().size());
+  write_section(ofs, header.prefix_sums_offset,
+                size_index.prefix_sums().data(),
+                size_index.prefix_sums().size());
+  // Pad out to the aligned end if the final section stops short of it, so
+  // that it's fully backed
+  ofs.seekp(0, std::ios::end);
+  if (static_cast<std::uint64_t>(ofs.tellp()) < header.total_bytes) {
+    write_section(ofs, header.total_bytes - 1, "", 1);
+  }
+  return ofs.good();
+}
+
+// A snapshot mapped read-only; queries are served straight from the mapping,
+// through the same lookups as `ParsedTree`. Loading checks every record once,
+// so that the lookups can trust them.
+class View {
+ public:
+  explicit View(const char* path) : file_{path} {
+    if (!file_.is_open() || file_.contents().size() < sizeof(Header)) {
+      return;
+    }
+    const char* const base = file_.contents().data();
+    const auto* header = reinterpret_cast<const Header*>(base);
+    if (header->magic != magic || header->version != version ||
+        header->total_bytes > file_.contents().size() ||
+        header->num_dirs == 0 ||
+        header->num_names >= std::numeric_limits<std::uint32_t>::max()) {
+      return;
+    }
+    // Every section must lie within the file before any span is handed out
+    const std::uint64_t total = header->total_bytes;
+    if (!fits<DirRecord>(header->dirs_offset, header->num_dirs, total) ||
+        !fits<FileRecord>(header->files_offset, header->num_files, total) ||
+        !fits<std::uint32_t>(header->child_links_offset,
+                             header->num_child_links, total) ||
+        !fits<std::uint32_t>(header->name_offsets_offset,
+                             header->num_names + 1, total) ||
+        !fits<char>(header->names_offset, header->name_bytes, total) ||
+        !fits<std::uint64_t>(header->sorted_sizes_offset, header->num_dirs,
+                             total) ||
+        !fits<std::uint64_t>(header->prefix_sums_offset,
+                             std::uint64_t{header->num_dirs} + 1, total)) {
+      return;
+    }
+    header_ = header;
+    if (!records_valid()) {
+      header_ = nullptr;
+    }
+  }
+
+  bool is_valid() const { return header_ != nullptr; }
+
+  const DirRecord& root() const { return dirs().front(); }
+  SizeIndex size_index() const {
+    return {section<std::uint64_t>(header_->sorted_sizes_offset,
+                                   header_->num_dirs),
+            section<std::uint64_t>(header_->prefix_sums_offset,
+                                   header_->num_dirs + 1)};
+  }
+
+  std::size_t num_dirs() const { return header_->num_dirs; }
+  std::uint64_t dir_size(const std::uint32_t index) const {
+    return dirs()[index].size;
+  }
+
+  // Resolves an absolute path one component at a time, scanning each
+  // directory's children by name
+  std::optional<std::uint32_t> find_dir(std::string_view path) const {
+    if (!path.starts_with(root_dir_name)) {
+      return {};
+    }
+    std::uint32_t index{};
+    while (!path.empty()) {
+      const std::size_t end = std::min(path.find('/'), path.size());
+      const std::string_view component = path.substr(0, end);
+      path.remove_prefix(std::min(end + 1, path.size()));
+      if (component.empty()) {
+        continue;
+      }
+      const auto children = child_dirs(dirs()[index]);
+      const auto child = std::find_if(
+          children.begin(), children.end(), [&](const std::uint32_t child) {
+            return name(dirs()[child].name) == component;
+          });
+      if (child == children.end()) {
+        return {};
+      }
+      index = *child;
+    }
+    return index;
+  }
+
+  std::size_t depth(std::uint32_t index) const {
+    std::size_t depth{};
+    for (; dirs()[index].parent != no_parent; index = dirs()[index].parent) {
+      ++depth;
+    }
+    return depth;
+  }
+
+  std::string path(std::uint32_t index) const {
+    std::vector<std::string_view> components;
+    for (; dirs()[index].parent != no_parent; index = dirs()[index].parent) {
+      components.push_back(name(dirs()[index].name));
+    }
+    if (components.empty()) {
+      return std::string{root_dir_name};
+    }
+    std::string path;
+    for (auto it = components.crbegin(); it != components.crend(); ++it) {
+      path += root_dir_name;
+      path += *it;
+    }
+    return path;
+  }
+
+  // Calls `visit` with the name and size of every file directly in `index`
+  template <typename Visit>
+  void for_each_file(const std::uint32_t index, const Visit& visit) const {
+    for (const FileRecord& file : files(dirs()[index])) {
+      visit(name(file.name), file.size);
+    }
+  }
+
+ private:
+  std::span<const DirRecord> dirs() const {
+    return section<DirRecord>(header_->dirs_offset, header_->num_dirs);
+  }
+  std::span<const FileRecord> files() const {
+    return section<FileRecord>(header_->files_offset, header_->num_files);
+  }
+  std::span<const FileRecord> files(const DirRecord& dir) const {
+    return files().subspan(dir.first_file, dir.num_files);
+  }
+  std::span<const std::uint32_t> child_links() const {
+    return section<std::uint32_t>(header_->child_links_offset,
+                                  header_->num_child_links);
+  }
+  std::span<const std::uint32_t> child_dirs(const DirRecord& dir) const {
+    return child_links().subspan(dir.first_child_link, dir.num_child_dirs);
+  }
+  std::span<const std::uint32_t> name_offsets() const {
+    return section<std::uint32_t>(header_->name_offsets_offset,
+                                  header_->num_names + 1);
+  }
+  std::string_view name(const std::uint32_t id) const {
+    const auto offsets = name_offsets();
+    return {file_.contents().data() + header_->names_offset + offsets[id],
+            offsets[id + 1] - offsets[id]};
+  }
+
+  // Whether every name lies within the name bytes, every range within its
+  // table, and every directory comes after its parent and is linked from it,
+  // so that walks up and down the tree stay in bounds and end
+  bool records_valid() const {
+    const auto offsets = name_offsets();
+    for (std::size_t id{}; id < header_->num_names; ++id) {
+      if (offsets[id] > offsets[id + 1]) {
+        return false;
+      }
+    }
+    if (offsets.back() > header_->name_bytes) {
+      return false;
+    }
+    const auto within = [](const std::uint64_t first, const std::uint64_t count,
+                           const std::uint64_t size) {
+      return first <= size && count <= size - first;
+    };
+    const auto dir_records = dirs();
+    for (std::uint32_t index{}; index < dir_records.size(); ++index) {
+      const DirRecord& dir = dir_records[index];
+      if (dir.name >= header_->num_names ||
+          (index == 0 ? dir.parent != no_parent : dir.parent >= index) ||
+          !within(dir.first_child_link, dir.num_child_dirs,
+                  header_->num_child_links) ||
+          !within(dir.first_file, dir.num_files, header_->num_files)) {
+        return false;
+      }
+      for (const std::uint32_t child : child_dirs(dir)) {
+        if (child >= dir_records.size() || dir_records[child].parent != index) {
+          return false;
+        }
+      }
+    }
+    for (const FileRecord& file : files()) {
+      if (file.name >= header_->num_names || file.parent >= header_->num_dirs) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Whether `count` values of `T` from `offset` end by `total_bytes`, without
+  // overflowing on a corrupt header
+  template <typename T>
+  static bool fits(const std::uint64_t offset, const std::uint64_t count,
+                   const std::uint64_t total_bytes) {
+    return offset <= total_bytes &&
+           count <= (total_bytes - offset) / sizeof(T);
+  }
+
+  template <typename T>
+  std::span<const T> section(const std::uint64_t offset,
+                             const std::uint64_t count) const {
+    return {reinterpret_cast<const T*>(file_.contents().data() + offset),
+            count};
+  }
+
+  MappedFile file_;
+  const Header* header_{nullptr};
+};
+}  // namespace Snapshot
+
+// Maps (parent directory, name) pairs to child directories, so that absolute
+// paths resolve in one hash lookup per component
+class PathIndex {
+ public:
+  PathIndex(const std::vector<const Directory*>& dirs, const NamePool& names)
+      : dirs_{dirs}, names_{names}, depths_(dirs.size()) {
+    for (const Directory* dir : dirs) {
+      for (const auto& child_dir : dir->child_dirs()) {
+        children_.emplace(key(dir->index(), child_dir->name()),
+                          child_dir->index());
+        depths_[child_dir->index()] = depths_[dir->index()] + 1;
+      }
+    }
+  }
+
+  std::optional<std::uint32_t> find_dir(std::string_view path) const {
+    if (!path.starts_with(root_dir_name)) {
+      return {};
+    }
+    std::uint32_t index{};
+    while (!path.empty()) {
+      const std::size_t end = std::min(path.find('/'), path.size());
+      const std::string_view component = path.substr(0, end);
+      path.remove_prefix(std::min(end + 1, path.size()));
+      if (component.empty()) {
+        continue;
+      }
+      const auto maybe_name = names_.find(component);
+      if (!maybe_name) {
+        return {};
+      }
+      const auto child = children_.find(key(index, *maybe_name));
+      if (child == children_.cend()) {
+        return {};
+      }
+      index = child->second;
+    }
+    return index;
+  }
+
+  const Directory& dir(const std::uint32_t index) const {
+    return *dirs_[index];
+  }
+  std::size_t depth(const std::uint32_t index) const { return depths_[index]; }
+
+  std::string path(const std::uint32_t index) const {
+    std::vector<std::string_view> components;
+    for (const Directory* dir = dirs_[index]; dir->parent() != nullptr;
+         dir = dir->parent()) {
+      components.push_back(names_.name(dir->name()));
+    }
+    if (components.empty()) {
+      return std::string{root_dir_name};
+    }
+    std::string path;
+    for (auto it = components.crbegin(); it != components.crend(); ++it) {
+      path += root_dir_name;
+      path += *it;
+    }
+    return path;
+  }
+
+ private:
+  static std::uint64_t key(const std::uint32_t parent,
+                           const NamePool::Id name) {
+    return std::uint64_t{parent} << 32 | name;
+  }
+
+  const std::vector<const Directory*>& dirs_;
+  const NamePool& names_;
+  std::vector<std::size_t> depths_;
+  std::unordered_map<std::uint64_t, std::uint32_t> children_{};
+};
+
+// The interpreter's tree and its directory sizes, as `QueryEngine` reads them
+class ParsedTree {
+ public:
+  ParsedTree(const Interpreter& interpreter,
+             const std::vector<std::uint64_t>& dir_sizes)
+      : names_{interpreter.names()},
+        paths_{interpreter.directories(), interpreter.names()},
+        dir_sizes_{dir_sizes} {}
+
+  std::size_t num_dirs() const { return dir_sizes_.size(); }
+  std::uint64_t dir_size(const std::uint32_t index) const {
+    return dir_sizes_[index];
+  }
+  std::optional<std::uint32_t> find_dir(const std::string_view path) const {
+    return paths_.find_dir(path);
+  }
+  std::size_t depth(const std::uint32_t index) const {
+    return paths_.depth(index);
+  }
+  std::string path(const std::uint32_t index) const {
+    return paths_.path(index);
+  }
+  // Calls `visit` with the name and size of every file directly in `index`
+  template <typename Visit>
+  void for_each_file(const std::uint32_t index, const Visit& visit) const {
+    for (const auto& file : paths_.dir(index).files()) {
+      visit(names_.name(file->name), file->size);
+    }
+  }
+
+ private:
+  const NamePool& names_;
+  const PathIndex paths_;
+  const std::vector<std::uint64_t>& dir_sizes_;
+};
+
+class Query {
+ public:
+  enum class Type {
+    size,
+    top,
+    deeper,
+    suffix,
+    total_at_most,
+    smallest_at_least,
+    count_between,
+    kth_largest,
+  };
+
+  constexpr static frozen::unordered_map<frozen::string, Type, 8> str_to_type{
+      {"size", Type::size},
+      {"top", Type::top},
+      {"deeper", Type::deeper},
+      {"suffix", Type::suffix},
+      {"total-at-most", Type::total_at_most},
+      {"smallest-at-least", Type::smallest_at_least},
+      {"count-between", Type::count_between},
+      {"kth-largest", Type::kth_largest},
+  };
+};
+
+// The next word of a query's arguments as a number, 0 when there is none
+std::uint64_t next_number(std::string_view& arguments) {
+  const std::string_view word = next_word(arguments);
+  std::uint64_t value{};
+  std::from_chars(word.data(), word.data() + word.size(), value);
+  return value;
+}
+
+void print_maybe(std::ostream& os, const std::optional<std::uint64_t> value) {
+  if (value) {
+    os << *value << '\n';
+  } else {
+    os << "none\n";
+  }
+}
+
+// Answers the threshold queries, which need nothing but the size index and
+// so can be served from a snapshot too. Returns false for any other query.
+bool answer_size_query(const SizeIndex& size_index, const Query::Type type,
+                       std::string_view arguments, std::ostream& os) {
+  switch (type) {
+    case Query::Type::total_at_most:
+      os << size_index.total_at_most(next_number(arguments)) << '\n';
+      break;
+    case Query::Type::smallest_at_least:
+      print_maybe(os, size_index.smallest_at_least(next_number(arguments)));
+      break;
+    case Query::Type::count_between: {
+      const std::uint64_t lower = next_number(arguments);
+      const std::uint64_t upper = next_number(arguments);
+      os << size_index.count_between(lower, upper) << '\n';
+    } break;
+    case Query::Type::kth_largest:
+      print_maybe(os, size_index.kth_largest(next_number(arguments)));
+      break;
+    default:
+      return false;
+  }
+  return true;
+}
+
+// Reads queries one per line, echoing each before `answer` is handed its
+// type and the arguments that follow it
+template <typename Answer>
+void run_queries(std::istream& is, std::ostream& os, const Answer& answer) {
+  for (std::string line; std::getline(is, line);) {
+    if (line.empty()) {
+      continue;
+    }
+    os << "> " << line << '\n';
+    std::string_view arguments = line;
+    const std::string_view type_str = next_word(arguments);
+    if (const auto type = Query::str_to_type.find(frozen::string{type_str});
+        type != Query::str_to_type.end()) {
+      answer(type->second, arguments);
+    } else {
+      os << "unknown query\n";
+    }
+  }
+}
+
+// Answers batches of queries against one tree, one per line:
+//   size PATH                  size of a directory or file
+//   top K                      the K largest directories
+//   deeper DEPTH SIZE          directories below DEPTH and larger than SIZE
+//   suffix TEXT                files whose name ends in TEXT
+//   total-at-most SIZE         sum of directory sizes <= SIZE
+//   smallest-at-least SIZE     smallest directory size >= SIZE
+//   count-between LOWER UPPER  number of directory sizes in [LOWER, UPPER]
+//   kth-largest K              K-th largest directory size
+// Results follow an echo of their query, one per line as `size path` where
+// there is a path to report. The tree is either a `ParsedTree` or a mapped
+// `Snapshot::View`, which provide the same lookups.
+template <typename Tree>
+class QueryEngine {
+ public:
+  QueryEngine(const Tree& tree, const SizeIndex& size_index)
+      : tree_{tree}, size_index_{size_index} {}
+
+  void run(std::istream& is, std::ostream& os) const {
+    run_queries(is, os, [this, &os](const Query::Type type,
+                                    std::string_view arguments) {
+      answer(type, arguments, os);
+    });
+  }
+
+  void answer(const Query::Type type, std::string_view arguments,
+              std::ostream& os) const {
+    if (answer_size_query(size_index_, type, arguments, os)) {
+      return;
+    }
+    switch (type) {
+      case Query::Type::size:
+        print_maybe(os, size_of(next_word(arguments)));
+        break;
+      case Query::Type::top: {
+        const auto& by_size = sorted_by_size();
+        const std::size_t k =
+            std::min<std::size_t>(next_number(arguments), by_size.size());
+        for (std::size_t rank{}; rank < k; ++rank) {
+          print_dir(by_size[rank], os);
+        }
+      } break;
+      case Query::Type::deeper: {
+        const std::uint64_t min_depth = next_number(arguments);
+        const std::uint64_t min_size = next_number(arguments);
+        // Sizes descend, so stop at the first one too small
+        for (const std::uint32_t index : sorted_by_size()) {
+          if (tree_.dir_size(index) <= min_size) {
+            break;
+          }
+          if (tree_.depth(index) > min_depth) {
+            print_dir(index, os);
+          }
+        }
+      } break;
+      case Query::Type::suffix: {
+        const std::string_view suffix = next_word(arguments);
+        for (std::uint32_t index{}; index < tree_.num_dirs(); ++index) {
+          tree_.for_each_file(index, [&](const std::string_view name,
+                                         const std::uint64_t size) {
+            if (name.ends_with(suffix)) {
+              os << size << ' ' << file_path(index, name) << '\n';
+            }
+          });
+        }
+      } break;
+      default:
+        std::unreachable();
+    }
+  }
+
+ private:
+  std::optional<std::uint64_t> size_of(const std::string_view path) const {
+    if (const auto index = tree_.find_dir(path)) {
+      return tree_.dir_size(*index);
+    }
+    // Not a directory, so try it as a file in its parent
+    const std::size_t slash = path.rfind('/');
+    if (slash == std::string_view::npos) {
+      return {};
+    }
+    const auto parent =
+        tree_.find_dir(path.substr(0, std::max<std::size_t>(slash, 1)));
+    if (!parent) {
+      return {};
+    }
+    const std::string_view file_name = path.substr(slash + 1);
+    std::optional<std::uint64_t> file_size;
+    tree_.for_each_file(*parent, [&](const std::string_view name,
+                                     const std::uint64_t size) {
+      if (!file_size && name == file_name) {
+        file_size = size;
+      }
+    });
+    return file_size;
+  }
+
+  // Directory indices from largest to smallest, sorted on first use since
+  // only `top` and `deeper` need them
+  const std::vector<std::uint32_t>& sorted_by_size() const {
+    if (by_size_.size() != tree_.num_dirs()) {
+      by_size_.resize(tree_.num_dirs());
+      std::iota(by_size_.begin(), by_size_.end(), 0);
+      std::stable_sort(by_size_.begin(), by_size_.end(),
+                       [this](const std::uint32_t lhs,
+                              const std::uint32_t rhs) {
+                         return tree_.dir_size(lhs) > tree_.dir_size(rhs);
+                       });
+    }
+    return by_size_;
+  }
+
+  void print_dir(const std::uint32_t index, std::ostream& os) const {
+    os << tree_.dir_size(index) << ' ' << tree_.path(index) << '\n';
+  }
+
+  std::string file_path(const std::uint32_t index,
+                        const std::string_view name) const {
+    std::string path = tree_.path(index);
+    if (index != 0) {
+      path += root_dir_name;
+    }
+    path += name;
+    return path;
+  }
+
+  const Tree& tree_;
+  const SizeIndex& size_index_;
+  mutable std::vector<std::uint32_t> by_size_{};
+};
+
+void print_answers(const SizeIndex& size_index, const std::uint64_t root_size) {
+  std::cout << "Problem 1: " << size_index.total_at_most(dir_size_limit)
+            << '\n';
+
+  const std::uint64_t free_req = unused_space - (filesystem_space - root_size);
+  std::cout << "Problem 2: " << size_index.smallest_at_least(free_req).value()
+            << '\n';
+}
+
+// Builds a `depth`-long chain of directories with a 1 GiB file in each, so the
+// root holds about a petabyte, and times every stage against the closed form
+bool run_stress_benchmark(const std::size_t depth,
+                          const std::size_t num_threads) {
+  constexpr const std::uint64_t file_size = std::uint64_t{1} << 30;
+  using Clock = std::chrono::steady_clock;
+  const auto elapsed_ms = [](const Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start)
+        .count();
+  };
+
+  std::string transcript{"$ cd /\n"};
+  const std::string level =
+      "$ ls\ndir d\n" + std::to_string(file_size) + " f\n$ cd d\n";
+  transcript.reserve(transcript.size() + depth * level.size());
+  for (std::size_t level_idx{}; level_idx < depth; ++level_idx) {
+    transcript += level;
+  }
+  transcript += "$ ls\n" + std::to_string(file_size) + " f\n";
+
+  auto start = Clock::now();
+  Interpreter interpreter;
+  interpreter.run(transcript);
+  const double parse_ms = elapsed_ms(start);
+
+  const auto& dirs = interpreter.directories();
+  std::vector<std::uint64_t> serial_sizes(dirs.size());
+  start = Clock::now();
+  collect_dir_sizes(*interpreter.root(), serial_sizes);
+  const double serial_ms = elapsed_ms(start);
+
+  WorkStealingPool pool{num_threads};
+  start = Clock::now();
+  const auto parallel_sizes = collect_dir_sizes_parallel(dirs, pool);
+  const double parallel_ms = elapsed_ms(start);
+
+  start = Clock::now();
+  const SizeIndex size_index{serial_sizes};
+  const double index_ms = elapsed_ms(start);
+
+  // The directory at depth k holds the files of the depth - k + 1 below it
+  const std::uint64_t root_size = (depth + 1) * file_size;
+  const bool verified =
+      serial_sizes == parallel_sizes && serial_sizes.front() == root_size &&
+      interpreter.root()->size() == root_size &&
+      size_index.kth_largest(1) == root_size &&
+      size_index.smallest_at_least(1) == file_size &&
+      size_index.count_between(file_size, root_size) == depth + 1;
+
+  std::cout << "Stress: " << depth << "-deep chain, root size " << root_size
+            << " bytes\n"
+            << "  parse: " << parse_ms << " ms\n"
+            << "  serial sizes: " << serial_ms << " ms\n"
+            << "  parallel sizes (" << pool.num_threads()
+            << " threads): " << parallel_ms << " ms\n"
+            << "  size index: " << index_ms << " ms\n"
+            << "  " << (verified ? "verified" : "MISMATCH") << '\n';
+  return verified;
+}
+
+// Answers the queries in `path`, or stdin for `-`, against `tree`
+template <typename Tree>
+bool answer_queries(const char* path, const Tree& tree,
+                    const SizeIndex& size_index) {
+  const QueryEngine engine{tree, size_index};
+  if (std::string_view{path} == "-") {
+    engine.run(std::cin, std::cout);
+  } else if (std::ifstream ifs{path}; ifs.is_open()) {
+    engine.run(ifs, std::cout);
+  } else {
+    std::cerr << "Could not read queries: " << path << '\n';
+    return false;
+  }
+  return true;
+}
+
+int main(int argc, char* argv[]) {
+  // `--threads N` computes directory sizes on a pool of N workers,
+  // `--save-snapshot PATH` writes the parsed tree out after solving and
+  // `--load-snapshot PATH` answers from such a file instead of parsing `input`,
+  // `--stress DEPTH` runs the deep-chain benchmark instead, and
+  // `--query PATH` answers the queries in PATH (or stdin, for `-`) instead of
+  // the puzzle. `--print-tree` prints the parsed tree first.
+  std::size_t num_threads{1};
+  std::size_t stress_depth{};
+  const char* query_path{nullptr};
+  const char* save_path{nullptr};
+  const char* load_path{nullptr};
+  bool print{false};
+  for (int arg{1}; arg < argc; ++arg) {
+    print |= std::string_view{argv[arg]} == "--print-tree";
+  }
+  for (int arg{1}; arg + 1 < argc; ++arg) {
+    const std::string_view option{argv[arg]};
+    if (option == "--threads") {
+      num_threads = std::stoul(argv[++arg]);
+    } else if (option == "--save-snapshot") {
+      save_path = argv[++arg];
+    } else if (option == "--load-snapshot") {
+      load_path = argv[++arg];
+    } else if (option == "--stress") {
+      stress_depth = std::stoul(argv[++arg]);
+    } else if (option == "--query") {
+      query_path = argv[++arg];
+    }
+  }
+
+  if (stress_depth > 0) {
+    return run_stress_benchmark(stress_depth, num_threads) ? 0 : 1;
+  }
+
+  if (load_path != nullptr) {
+    const Snapshot::View snapshot{load_path};
+    if (!snapshot.is_valid()) {
+      std::cerr << "Not a readable snapshot: " << load_path << '\n';
+      return 1;
+    }
+    const SizeIndex size_index = snapshot.size_index();
+    if (query_path != nullptr) {
+      return answer_queries(query_path, snapshot, size_index) ? 0 : 1;
+    }
+    print_answers(size_index, snapshot.root().size);
+    return 0;
+  }
+
+  Interpreter interpreter;
+  if (const MappedFile input{"input"}; input.is_open()) {
+    interpreter.run(input.contents());
+  }
+  const auto& root = interpreter.root();
+  if (print) {
+    print_tree(std::cout, *root, interpreter.names());
+  }
+
+  std::vector<std::uint64_t> dir_sizes(interpreter.directories().size());
+  if (num_threads > 1) {
+    WorkStealingPool pool{num_threads};
+    dir_sizes = collect_dir_sizes_parallel(interpreter.directories(), pool);
+  } else {
+    collect_dir_sizes(*root, dir_sizes);
+  }
+  const std::uint64_t root_size = dir_sizes[root->index()];
+  const SizeIndex size_index{dir_sizes};
+  if (query_path != nullptr) {
+    if (!answer_queries(query_path, ParsedTree{interpreter, dir_sizes},
+                        size_index)) {
+      return 1;
+    }
+  } else {
+    print_answers(size_index, root_size);
+  }
+
+  if (save_path != nullptr &&
+      !Snapshot::save(save_path, interpreter.directories(), interpreter.names(),
+                      dir_sizes, size_index)) {
+    std::cerr << "Could not write snapshot: " << save_path << '\n';
+    return 1;
+  }
 }
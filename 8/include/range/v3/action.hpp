@@ -1,42 +0,0 @@
-/// \file
-// Range v3 library
-//
-//  Copyright Eric Niebler 2014-present
-//
-//  Use, modification and distribution is subject to the
-//  Boost Software License, Version 1.0. (See accompanying
-//  file LICENSE_1_0.txt or copy at
-//  http://www.boost.org/LICENSE_1_0.txt)
-//
-// Project home: https://github.com/ericniebler/range-v3
-//
-
-#ifndef RANGES_V3_ACTION_HPP
-#define RANGES_V3_ACTION_HPP
-
-#include <range/v3/action/action.hpp>
-#include <range/v3/action/adjacent_remove_if.hpp>
-#include <range/v3/action/concepts.hpp>
-#include <range/v3/action/drop.hpp>
-#include <range/v3/action/drop_while.hpp>
-#include <range/v3/action/erase.hpp>
-#include <range/v3/action/insert.hpp>
-#include <range/v3/action/join.hpp>
-#include <range/v3/action/push_back.hpp>
-#include <range/v3/action/push_front.hpp>
-#include <range/v3/action/remove_if.hpp>
-#include <range/v3/action/reverse.hpp>
-#include <range/v3/action/shuffle.hpp>
-#include <range/v3/action/slice.hpp>
-#include <range/v3/action/sort.hpp>
-#include <range/v3/action/split.hpp>
-#include <range/v3/action/split_when.hpp>
-#include <range/v3/action/stable_sort.hpp>
-#include <range/v3/action/stride.hpp>
-#include <range/v3/action/take.hpp>
-#include <range/v3/action/take_while.hpp>
-#include <range/v3/action/transform.hpp>
-#include <range/v3/action/unique.hpp>
-#include <range/v3/action/unstable_remove_if.hpp>
-
-#endif
@@ -1,19 +0,0 @@
-/// \file
-// Range v3 library
-//
-//  Copyright Eric Niebler 2021-present
-//
-//  Use, modification and distribution is subject to the
-//  Boost Software License, Version 1.0. (See accompanying
-//  file LICENSE_1_0.txt or copy at
-//  http://www.boost.org/LICENSE_1_0.txt)
-//
-// Project home: https://github.com/ericniebler/range-v3
-
-#ifndef RANGES_V3_ALGORITHM_FOLD_HPP
-#define RANGES_V3_ALGORITHM_FOLD_HPP
-
-#include <range/v3/algorithm/fold_left.hpp>
-#include <range/v3/algorithm/fold_right.hpp>
-
-#endif
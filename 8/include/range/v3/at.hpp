@@ -1,23 +0,0 @@
-// Range v3 library
-//
-//  Copyright Eric Niebler 2014-present
-//  Copyright Gonzalo Brito Gadeschi 2017
-//
-//  Use, modification and distribution is subject to the
-//  Boost Software License, Version 1.0. (See accompanying
-//  file LICENSE_1_0.txt or copy at
-//  http://www.boost.org/LICENSE_1_0.txt)
-//
-// Project home: https://github.com/ericniebler/range-v3
-//
-
-#ifndef RANGES_V3_AT_HPP
-#define RANGES_V3_AT_HPP
-
-#include <range/v3/detail/config.hpp>
-RANGES_DEPRECATED_HEADER(
-    "This header is deprecated. Please #include <range/v3/range/operations.hpp> instead.")
-
-#include <range/v3/range/operations.hpp>
-
-#endif
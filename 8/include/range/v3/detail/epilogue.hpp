@@ -1,22 +0,0 @@
-// Range v3 library
-//
-//  Copyright Eric Niebler 2013-present
-//
-//  Use, modification and distribution is subject to the
-//  Boost Software License, Version 1.0. (See accompanying
-//  file LICENSE_1_0.txt or copy at
-//  http://www.boost.org/LICENSE_1_0.txt)
-//
-// Project home: https://github.com/ericniebler/range-v3
-//
-
-#ifndef RANGES_PROLOGUE_INCLUDED
-#error "Including epilogue, but prologue not included!"
-#endif
-#undef RANGES_PROLOGUE_INCLUDED
-
-#undef template
-#undef AND
-#undef declval
-
-RANGES_DIAGNOSTIC_POP
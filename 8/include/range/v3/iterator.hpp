@@ -1,32 +0,0 @@
-/// \file
-// Range v3 library
-//
-//  Copyright Eric Niebler 2019-present
-//
-//  Use, modification and distribution is subject to the
-//  Boost Software License, Version 1.0. (See accompanying
-//  file LICENSE_1_0.txt or copy at
-//  http://www.boost.org/LICENSE_1_0.txt)
-//
-// Project home: https://github.com/ericniebler/range-v3
-//
-
-#ifndef RANGES_V3_ITERATOR_HPP
-#define RANGES_V3_ITERATOR_HPP
-
-#include <range/v3/iterator/access.hpp>
-#include <range/v3/iterator/basic_iterator.hpp>
-#include <range/v3/iterator/common_iterator.hpp>
-#include <range/v3/iterator/concepts.hpp>
-#include <range/v3/iterator/counted_iterator.hpp>
-#include <range/v3/iterator/default_sentinel.hpp>
-#include <range/v3/iterator/diffmax_t.hpp>
-#include <range/v3/iterator/insert_iterators.hpp>
-#include <range/v3/iterator/move_iterators.hpp>
-#include <range/v3/iterator/operations.hpp>
-#include <range/v3/iterator/reverse_iterator.hpp>
-#include <range/v3/iterator/stream_iterators.hpp>
-#include <range/v3/iterator/traits.hpp>
-#include <range/v3/iterator/unreachable_sentinel.hpp>
-
-#endif
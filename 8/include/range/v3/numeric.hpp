@@ -1,20 +0,0 @@
-///////////////////////////////////////////////////////////////////////////////
-/// \file numeric.hpp
-///   Contains range-based versions of the numeric algorithms
-//
-// Copyright Eric Niebler 2014-present
-//
-// Distributed under the Boost Software License, Version 1.0. (See
-// accompanying file LICENSE_1_0.txt or copy at
-// http://www.boost.org/LICENSE_1_0.txt)
-
-#ifndef RANGES_V3_NUMERIC_HPP
-#define RANGES_V3_NUMERIC_HPP
-
-#include <range/v3/numeric/accumulate.hpp>
-#include <range/v3/numeric/adjacent_difference.hpp>
-#include <range/v3/numeric/inner_product.hpp>
-#include <range/v3/numeric/iota.hpp>
-#include <range/v3/numeric/partial_sum.hpp>
-
-#endif
@@ -1,202 +1,1424 @@
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <functional>
 #include <iostream>
 #include <iterator>
-#include <numeric>
-#include <optional>
-#include <range/v3/algorithm/for_each.hpp>
-#include <range/v3/view/drop.hpp>
-#include <range/v3/view/filter.hpp>
-#include <range/v3/view/take.hpp>
-#include <range/v3/view/unique.hpp>
+#include <limits>
+#include <random>
+#include <span>
+#include <sstream>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <type_traits>
-#include <unordered_set>
 #include <vector>
 
-struct Tree {
-  using type = Tree;
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
 
-  template <bool visibility>
-  struct set_visibility {
-    void operator()(Tree& tree) {
-      if (!tree.maybe_visible.has_value()) {
-        tree.maybe_visible = visibility;
-      } else {
-        tree.maybe_visible = tree.maybe_visible.value() | visibility;
+class MappedFile {
+ public:
+  explicit MappedFile(const char* path) {
+    const int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+      return;
+    }
+    struct stat file_stat;
+    if (::fstat(fd, &file_stat) == 0 && file_stat.st_size > 0) {
+      void* const data = ::mmap(nullptr, file_stat.st_size, PROT_READ,
+                                MAP_PRIVATE, fd, 0);
+      if (data != MAP_FAILED) {
+        data_ = static_cast<const char*>(data);
+        size_ = file_stat.st_size;
+        ::madvise(data, size_, MADV_SEQUENTIAL);
+      }
+    }
+    ::close(fd);
+  }
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  ~MappedFile() {
+    if (is_open()) {
+      ::munmap(const_cast<char*>(data_), size_);
+    }
+  }
+
+  bool is_open() const { return data_ != nullptr; }
+  std::string_view contents() const { return {data_, size_}; }
+
+  // Lets the kernel drop the pages of [begin, end) once they've been read
+  void release(std::size_t begin, std::size_t end) const {
+    const std::size_t page_size = ::sysconf(_SC_PAGESIZE);
+    begin = begin / page_size * page_size;
+    if (begin < end) {
+      ::madvise(const_cast<char*>(data_) + begin, end - begin, MADV_DONTNEED);
+    }
+  }
+
+ private:
+  const char* data_{nullptr};
+  std::size_t size_{};
+};
+
+// Tree heights stored row-major in one contiguous buffer, one `Height` per
+// tree, alongside a bitset recording which trees are visible from outside the
+// grid. A nonzero `Radix` promises that every height is below it, which lets
+// the engines use per-height tables and byte kernels.
+template <typename Height, std::size_t Radix = 0>
+class Grid {
+  static_assert(std::is_floating_point_v<Height> ||
+                    sizeof(Height) < sizeof(std::int64_t),
+                "running maxima must fit below the shortest height");
+
+ public:
+  using height_type = Height;
+  static constexpr const std::size_t radix = Radix;
+
+  // Appends a row of ASCII digits; the first row fixes the width
+  void append_row(const std::string_view line)
+    requires(Radix == 10)
+  {
+    constexpr const char zero = '0';
+    start_row(line.size());
+    std::transform(line.cbegin(), line.cend(), std::back_inserter(heights_),
+                   [](const char height) -> Height {
+                     return static_cast<Height>(height - zero);
+                   });
+    finish_row();
+  }
+
+  // Appends a row of heights; the first row fixes the width
+  void append_row(const std::span<const Height> heights) {
+    start_row(heights.size());
+    heights_.insert(heights_.end(), heights.begin(), heights.end());
+    finish_row();
+  }
+
+  // Rows are padded to a multiple of this many cells, so that every row
+  // starts on a fresh visibility word and vector loads stay within the buffer
+  static constexpr const std::size_t stride_alignment = 64;
+
+  std::size_t rows() const { return rows_; }
+  std::size_t cols() const { return cols_; }
+  // Distance in cells between vertically adjacent trees
+  std::size_t stride() const { return stride_; }
+
+  std::size_t offset(const std::size_t row, const std::size_t col) const {
+    return row * stride_ + col;
+  }
+  const Height* row(const std::size_t row) const {
+    return heights_.data() + offset(row, 0);
+  }
+  Height height(const std::size_t offset) const { return heights_[offset]; }
+  Height height(const std::size_t row, const std::size_t col) const {
+    return heights_[offset(row, col)];
+  }
+  // Visibility marked earlier isn't refreshed
+  void set_height(const std::size_t row, const std::size_t col,
+                  const Height height) {
+    heights_[offset(row, col)] = height;
+  }
+
+  bool visible(const std::size_t offset) const {
+    return (visible_[offset / bits_per_word] >> (offset % bits_per_word)) & 1;
+  }
+  void set_visible(const std::size_t offset) {
+    visible_[offset / bits_per_word] |= std::uint64_t{1}
+                                        << (offset % bits_per_word);
+  }
+
+  // Sets the visibility of 32 trees at once from the low bits of `bits`,
+  // where `offset` is a multiple of 32
+  void set_visible_bits(const std::size_t offset, const std::uint32_t bits) {
+    visible_[offset / bits_per_word] |= std::uint64_t{bits}
+                                        << (offset % bits_per_word);
+  }
+
+  std::size_t num_visible() const {
+    std::size_t num_visible{};
+    for (const std::uint64_t word : visible_) {
+      num_visible += std::popcount(word);
+    }
+    return num_visible;
+  }
+
+ private:
+  static constexpr const std::size_t bits_per_word = 64;
+
+  void start_row(const std::size_t cols) {
+    if (rows_ == 0) {
+      cols_ = cols;
+      stride_ = (cols_ + stride_alignment - 1) / stride_alignment *
+                stride_alignment;
+    }
+  }
+  void finish_row() {
+    heights_.resize((rows_ + 1) * stride_);
+    ++rows_;
+    visible_.resize((rows_ * stride_ + bits_per_word - 1) / bits_per_word);
+  }
+
+  std::size_t rows_{};
+  std::size_t cols_{};
+  std::size_t stride_{};
+  std::vector<Height> heights_{};
+  std::vector<std::uint64_t> visible_{};
+};
+
+// The puzzle's own grids, of single digits
+using DigitGrid = Grid<std::uint8_t, 10>;
+
+// Running maxima are kept wide enough to start below the shortest height, so
+// that edge trees always count as visible
+template <typename Height>
+using Level = std::conditional_t<std::is_floating_point_v<Height>, Height,
+                                 std::int64_t>;
+
+template <typename Height>
+constexpr const Level<Height> below_ground =
+    std::is_floating_point_v<Height>
+        ? -std::numeric_limits<Level<Height>>::infinity()
+        : Level<Height>{-1};
+
+// Appends comma-separated heights, one row per line, to `grid`. Fails on a
+// value that doesn't parse as a `Height` or a row whose width differs from
+// the first.
+template <typename Height, std::size_t Radix>
+bool load_csv(const std::string_view contents, Grid<Height, Radix>& grid) {
+  std::vector<Height> heights;
+  for (std::size_t begin{}; begin < contents.size();) {
+    const std::size_t end =
+        std::min(contents.find('\n', begin), contents.size());
+    std::string_view line = contents.substr(begin, end - begin);
+    begin = end + 1;
+    if (line.ends_with('\r')) {
+      line.remove_suffix(1);
+    }
+    if (line.empty()) {
+      continue;
+    }
+
+    heights.clear();
+    const char* next = line.data();
+    const char* const line_end = line.data() + line.size();
+    for (;;) {
+      while (next != line_end && *next == ' ') {
+        ++next;
+      }
+      Height height{};
+      const auto [parsed, error] = std::from_chars(next, line_end, height);
+      if (error != std::errc{}) {
+        return false;
+      }
+      heights.push_back(height);
+      for (next = parsed; next != line_end && *next == ' ';) {
+        ++next;
+      }
+      if (next == line_end) {
+        break;
+      }
+      if (*next++ != ',') {
+        return false;
+      }
+    }
+    if (grid.rows() > 0 && heights.size() != grid.cols()) {
+      return false;
+    }
+    grid.append_row(heights);
+  }
+  return true;
+}
+
+// Appends a binary raster to `grid`: the number of rows and of columns as
+// native 64-bit integers, then every height row-major in `Height`'s own
+// native representation. Fails if the size doesn't match the header.
+template <typename Height, std::size_t Radix>
+bool load_raster(const std::string_view contents, Grid<Height, Radix>& grid) {
+  std::uint64_t rows{};
+  std::uint64_t cols{};
+  constexpr const std::size_t header_size = sizeof rows + sizeof cols;
+  if (contents.size() < header_size) {
+    return false;
+  }
+  std::memcpy(&rows, contents.data(), sizeof rows);
+  std::memcpy(&cols, contents.data() + sizeof rows, sizeof cols);
+  const std::size_t row_size = cols * sizeof(Height);
+  const std::size_t body_size = contents.size() - header_size;
+  if (cols == 0 || cols > body_size / sizeof(Height) ||
+      rows != body_size / row_size || body_size % row_size != 0) {
+    return false;
+  }
+
+  std::vector<Height> heights(cols);
+  for (std::size_t row{}; row < rows; ++row) {
+    std::memcpy(heights.data(), contents.data() + header_size + row * row_size,
+                row_size);
+    grid.append_row(heights);
+  }
+  return true;
+}
+
+// Sweeps rows [row_begin, row_end) from the left and from the right
+template <typename Height, std::size_t Radix>
+void sweep_rows(Grid<Height, Radix>& grid, const std::size_t row_begin,
+                const std::size_t row_end) {
+  for (std::size_t row{row_begin}; row < row_end; ++row) {
+    const Height* const heights = grid.row(row);
+    Level<Height> max_height{below_ground<Height>};
+    for (std::size_t col{}; col < grid.cols(); ++col) {
+      if (heights[col] > max_height) {
+        max_height = heights[col];
+        grid.set_visible(grid.offset(row, col));
+      }
+    }
+    max_height = below_ground<Height>;
+    for (std::size_t col{grid.cols()}; col-- > 0;) {
+      if (heights[col] > max_height) {
+        max_height = heights[col];
+        grid.set_visible(grid.offset(row, col));
+      }
+    }
+  }
+}
+
+// Sweeps down (or up) columns [col_begin, col_end) a whole row at a time,
+// comparing each row against the running maximum of every column, so every
+// read is contiguous
+template <typename Height, std::size_t Radix>
+void sweep_cols_scalar(Grid<Height, Radix>& grid, const bool downward,
+                       const std::size_t col_begin, const std::size_t col_end) {
+  std::vector<Level<Height>> max_heights(col_end - col_begin,
+                                         below_ground<Height>);
+  for (std::size_t step{}; step < grid.rows(); ++step) {
+    const std::size_t row = downward ? step : grid.rows() - 1 - step;
+    const Height* const heights = grid.row(row);
+    for (std::size_t col{col_begin}; col < col_end; ++col) {
+      if (heights[col] > max_heights[col - col_begin]) {
+        max_heights[col - col_begin] = heights[col];
+        grid.set_visible(grid.offset(row, col));
       }
     }
+  }
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+// As `sweep_cols_scalar`, 32 columns per instruction. Digits fit in a signed
+// byte, so the running maxima start below ground at -1 and use the signed
+// compare and max. `col_begin` must be a multiple of 32.
+__attribute__((target("avx2"))) void sweep_cols_avx2(
+    DigitGrid& grid, const bool downward, const std::size_t col_begin,
+    const std::size_t col_end) {
+  constexpr const std::size_t lanes = sizeof(__m256i);
+  static_assert(DigitGrid::stride_alignment % lanes == 0);
+  std::vector<std::int8_t> max_heights(
+      (col_end - col_begin + lanes - 1) / lanes * lanes,
+      below_ground<std::uint8_t>);
+  for (std::size_t step{}; step < grid.rows(); ++step) {
+    const std::size_t row = downward ? step : grid.rows() - 1 - step;
+    const std::uint8_t* const heights = grid.row(row);
+    for (std::size_t col{col_begin}; col < col_end; col += lanes) {
+      const __m256i row_heights = _mm256_loadu_si256(
+          reinterpret_cast<const __m256i*>(heights + col));
+      __m256i* const col_maxes =
+          reinterpret_cast<__m256i*>(max_heights.data() + (col - col_begin));
+      const __m256i col_max = _mm256_loadu_si256(col_maxes);
+      std::uint32_t taller = static_cast<std::uint32_t>(
+          _mm256_movemask_epi8(_mm256_cmpgt_epi8(row_heights, col_max)));
+      // Padding past the last column never counts
+      if (const std::size_t remaining = col_end - col; remaining < lanes) {
+        taller &= (std::uint32_t{1} << remaining) - 1;
+      }
+      grid.set_visible_bits(grid.offset(row, col), taller);
+      _mm256_storeu_si256(col_maxes, _mm256_max_epi8(row_heights, col_max));
+    }
+  }
+}
+#endif
+
+template <typename Height, std::size_t Radix>
+void sweep_cols(Grid<Height, Radix>& grid, const bool downward,
+                const std::size_t col_begin, const std::size_t col_end) {
+#if defined(__x86_64__) || defined(__i386__)
+  if constexpr (std::is_same_v<Grid<Height, Radix>, DigitGrid>) {
+    if (__builtin_cpu_supports("avx2")) {
+      sweep_cols_avx2(grid, downward, col_begin, col_end);
+      return;
+    }
+  }
+#endif
+  sweep_cols_scalar(grid, downward, col_begin, col_end);
+}
+
+// Runs `task(index)` for every index in [0, num_tasks) on `num_threads`
+// threads, which claim indices from a shared counter
+template <typename Task>
+void parallel_for(const std::size_t num_threads, const std::size_t num_tasks,
+                  const Task& task) {
+  std::atomic<std::size_t> next{};
+  const auto work = [&next, num_tasks, &task] {
+    for (std::size_t index = next++; index < num_tasks; index = next++) {
+      task(index);
+    }
   };
+  std::vector<std::thread> threads;
+  for (std::size_t thread{1}; thread < num_threads; ++thread) {
+    threads.emplace_back(work);
+  }
+  work();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+// Splits [0, size) into `num_parts` ranges whose bounds are multiples of
+// `alignment`, apart from the final end
+std::vector<std::size_t> split_range(const std::size_t size,
+                                     const std::size_t num_parts,
+                                     const std::size_t alignment) {
+  const std::size_t part_size =
+      std::max<std::size_t>(1, (size + num_parts - 1) / num_parts);
+  const std::size_t aligned =
+      (part_size + alignment - 1) / alignment * alignment;
+  std::vector<std::size_t> bounds{0};
+  while (bounds.back() < size) {
+    bounds.push_back(std::min(size, bounds.back() + aligned));
+  }
+  return bounds;
+}
+
+// Marks every tree visible from outside the grid with four running-max
+// sweeps: along each row from both ends, and down and up the columns. Rows
+// split into bands and columns into strips that are independent of each
+// other; since every row starts on a fresh visibility word and strips are
+// word aligned, threads write disjoint words of the shared bitset. Both
+// column sweeps of a strip touch the same words, so one task runs them.
+template <typename Height, std::size_t Radix>
+void mark_visible(Grid<Height, Radix>& grid,
+                  const std::size_t num_threads = 1) {
+  const auto bands = split_range(grid.rows(), num_threads, 1);
+  parallel_for(num_threads, bands.size() - 1, [&](const std::size_t band) {
+    sweep_rows(grid, bands[band], bands[band + 1]);
+  });
+  const auto strips =
+      split_range(grid.cols(), num_threads, grid.stride_alignment);
+  parallel_for(num_threads, strips.size() - 1, [&](const std::size_t strip) {
+    sweep_cols(grid, true, strips[strip], strips[strip + 1]);
+    sweep_cols(grid, false, strips[strip], strips[strip + 1]);
+  });
+}
 
-  bool operator>(const Tree& other) const { return height > other.height; }
-  bool operator==(const Tree& other) const { return height == other.height; }
-  bool operator<(const Tree& other) const { return height < other.height; }
+struct ScoredTree {
+  std::uint64_t score;
+  std::size_t row;
+  std::size_t col;
 
-  std::size_t height;
-  std::optional<bool> maybe_visible{};
+  bool operator>(const ScoredTree& other) const {
+    return score > other.score;
+  }
 };
 
-std::ostream& operator<<(std::ostream& os, const Tree& tree) {
-  os << tree.height;
+std::ostream& operator<<(std::ostream& os, const ScoredTree& tree) {
+  os << tree.score << " at (" << tree.row << ',' << tree.col << ')';
   return os;
 }
 
-template <typename T>
-void mark_visible_impl(std::vector<T>& range) {
-  using BaseT = std::remove_cvref_t<typename T::type>;
+// Tracks the best scenic score seen so far and, optionally, the `top_k` best
+// trees
+class TopTrees {
+ public:
+  explicit TopTrees(const std::size_t top_k) : top_k_{top_k} {}
 
-  std::size_t max_height;
-  if constexpr (std::is_same_v<T, std::reference_wrapper<BaseT>>) {
-    max_height = range.front().get().height;
-  } else {
-    max_height = range.front().height;
+  void consider(const std::uint64_t score, const std::size_t row,
+                const std::size_t col) {
+    max_score_ = std::max(max_score_, score);
+    if (top_k_ == 0) {
+      return;
+    }
+    // A min-heap, so the worst of the best sits at the front
+    if (top_.size() < top_k_) {
+      top_.push_back({score, row, col});
+      std::push_heap(top_.begin(), top_.end(), std::greater<ScoredTree>{});
+    } else if (score > top_.front().score) {
+      std::pop_heap(top_.begin(), top_.end(), std::greater<ScoredTree>{});
+      top_.back() = {score, row, col};
+      std::push_heap(top_.begin(), top_.end(), std::greater<ScoredTree>{});
+    }
+  }
+
+  std::uint64_t max_score() const { return max_score_; }
+
+  // The best trees, best first
+  std::vector<ScoredTree> top() const {
+    std::vector<ScoredTree> top{top_.cbegin(), top_.cend()};
+    std::sort(top.begin(), top.end(), std::greater<ScoredTree>{});
+    return top;
   }
-  std::unordered_set<std::size_t> visible_heights{max_height};
-  for (auto it = std::next(range.cbegin()); it != range.cend();
-       it = std::next(it)) {
+
+ private:
+  std::size_t top_k_;
+  std::uint64_t max_score_{};
+  std::vector<ScoredTree> top_{};
+};
+
+// Computes every scenic score in one top-down pass over the rows, in
+// O(rows x cols) time and O(cols) memory, for heights below `NumHeights`.
+// Left, right and up viewing distances come from tables of the last position
+// at least as tall as each height. A tree's down distance is only known once a
+// later row blocks its view, so trees wait on a per-column monotonic stack
+// until then; since every tree pops the ones no taller than itself, a stack
+// never exceeds one tree per height.
+//
+// A scorer may also cover only a strip of columns. Its rows then come with
+// the tables as seen from just outside either side of the strip, which keeps
+// the left and right distances exact.
+template <std::size_t NumHeights>
+class ScenicScorer {
+ public:
+  static constexpr const std::size_t num_heights = NumHeights;
+
+  // The last column at least as tall as each height
+  using Seed = std::array<std::uint32_t, num_heights>;
+
+  // Keeps the `top_k` best trees as well as the best score
+  explicit ScenicScorer(const std::size_t cols, const std::size_t top_k = 0)
+      : ScenicScorer{cols, top_k, 0, cols} {}
+  // Scores columns [col_begin, col_end) of rows `cols` wide
+  ScenicScorer(const std::size_t cols, const std::size_t top_k,
+               const std::size_t col_begin, const std::size_t col_end)
+      : cols_{cols},
+        col_begin_{col_begin},
+        col_end_{col_end},
+        best_{top_k},
+        up_last_((col_end - col_begin) * num_heights),
+        left_right_(col_end - col_begin),
+        pending_((col_end - col_begin) * num_heights),
+        num_pending_(col_end - col_begin) {}
+
+  // Rows must arrive in order, top first. `heights` is the whole row, and the
+  // seeds default to seeing the grid's edges.
+  template <typename Height>
+  void add_row(const Height* const heights,
+               const Seed* const left_seed = nullptr,
+               const Seed* const right_seed = nullptr) {
+    // Left and right distances; the edge blocks the view when nothing does
+    std::array<std::size_t, num_heights> last{};
+    if (left_seed != nullptr) {
+      std::copy(left_seed->cbegin(), left_seed->cend(), last.begin());
+    }
+    for (std::size_t col{col_begin_}; col < col_end_; ++col) {
+      left_right_[col - col_begin_] = col - last[heights[col]];
+      std::fill_n(last.begin(), heights[col] + 1, col);
+    }
+    last.fill(cols_ - 1);
+    if (right_seed != nullptr) {
+      std::copy(right_seed->cbegin(), right_seed->cend(), last.begin());
+    }
+    for (std::size_t col{col_end_}; col-- > col_begin_;) {
+      left_right_[col - col_begin_] *= last[heights[col]] - col;
+      std::fill_n(last.begin(), heights[col] + 1, col);
+    }
+
+    for (std::size_t col{col_begin_}; col < col_end_; ++col) {
+      const std::size_t strip_col = col - col_begin_;
+      const std::size_t height = heights[col];
+      Pending* const stack = &pending_[strip_col * num_heights];
+      std::size_t& num_pending = num_pending_[strip_col];
+      while (num_pending > 0 && stack[num_pending - 1].height <= height) {
+        const Pending& blocked = stack[--num_pending];
+        best_.consider(blocked.partial_score * (row_ - blocked.row),
+                       blocked.row, col);
+      }
+
+      std::size_t* const up_last = &up_last_[strip_col * num_heights];
+      const std::uint64_t partial_score =
+          left_right_[strip_col] * (row_ - up_last[height]);
+      std::fill_n(up_last, height + 1, row_);
+      if (partial_score == 0) {
+        // On an edge, so nothing further down can change the score
+        best_.consider(0, row_, col);
+      } else {
+        stack[num_pending++] = {partial_score, row_, height};
+      }
+    }
+    ++row_;
+  }
+
+  // Resolves trees that see all the way to the bottom edge
+  void finish() {
+    for (std::size_t col{col_begin_}; col < col_end_; ++col) {
+      const std::size_t strip_col = col - col_begin_;
+      const Pending* const stack = &pending_[strip_col * num_heights];
+      for (std::size_t index{}; index < num_pending_[strip_col]; ++index) {
+        best_.consider(
+            stack[index].partial_score * (row_ - 1 - stack[index].row),
+            stack[index].row, col);
+      }
+      num_pending_[strip_col] = 0;
+    }
+  }
+
+  std::uint64_t max_score() const { return best_.max_score(); }
+
+  // The best trees, best first
+  std::vector<ScoredTree> top() const { return best_.top(); }
+
+ private:
+  struct Pending {
+    // Product of the up, left and right distances
+    std::uint64_t partial_score;
+    std::size_t row;
     std::size_t height;
-    if constexpr (std::is_same_v<T, std::reference_wrapper<BaseT>>) {
-      height = it->get().height;
-    } else {
-      height = it->height;
+  };
+
+  std::size_t cols_;
+  std::size_t col_begin_;
+  std::size_t col_end_;
+  std::size_t row_{};
+  TopTrees best_;
+  // Per column of the strip, the last row at least as tall as each height
+  std::vector<std::size_t> up_last_;
+  // Product of the left and right distances for the current row
+  std::vector<std::uint64_t> left_right_;
+  std::vector<Pending> pending_;
+  std::vector<std::size_t> num_pending_;
+};
+
+// As `ScenicScorer`, for heights of any range. With no bound on the number of
+// distinct heights, the tables give way to monotonic stacks: one across each
+// row for the left and right distances, and two per column, of the trees
+// still able to block the view up and of those still waiting to be blocked
+// below. Every tree is pushed and popped at most once per stack, so the pass
+// stays linear, but a stack may grow as tall as its column.
+template <typename Height>
+class StackScenicScorer {
+ public:
+  explicit StackScenicScorer(const std::size_t cols,
+                             const std::size_t top_k = 0)
+      : cols_{cols},
+        best_{top_k},
+        left_right_(cols),
+        blockers_(cols),
+        pending_(cols) {}
+
+  // Rows must arrive in order, top first
+  void add_row(const Height* const heights) {
+    // Left and right distances; the edge blocks the view when nothing does
+    row_stack_.clear();
+    for (std::size_t col{}; col < cols_; ++col) {
+      while (!row_stack_.empty() && heights[row_stack_.back()] < heights[col]) {
+        row_stack_.pop_back();
+      }
+      left_right_[col] = col - (row_stack_.empty() ? 0 : row_stack_.back());
+      row_stack_.push_back(col);
+    }
+    row_stack_.clear();
+    for (std::size_t col{cols_}; col-- > 0;) {
+      while (!row_stack_.empty() && heights[row_stack_.back()] < heights[col]) {
+        row_stack_.pop_back();
+      }
+      left_right_[col] *=
+          (row_stack_.empty() ? cols_ - 1 : row_stack_.back()) - col;
+      row_stack_.push_back(col);
+    }
+
+    for (std::size_t col{}; col < cols_; ++col) {
+      const Height height = heights[col];
+      auto& pending = pending_[col];
+      while (!pending.empty() && pending.back().height <= height) {
+        const Pending& blocked = pending.back();
+        best_.consider(blocked.partial_score * (row_ - blocked.row),
+                       blocked.row, col);
+        pending.pop_back();
+      }
+
+      auto& blockers = blockers_[col];
+      while (!blockers.empty() && blockers.back().height < height) {
+        blockers.pop_back();
+      }
+      const std::uint64_t partial_score =
+          left_right_[col] *
+          (row_ - (blockers.empty() ? 0 : blockers.back().row));
+      blockers.push_back({row_, height});
+      if (partial_score == 0) {
+        // On an edge, so nothing further down can change the score
+        best_.consider(0, row_, col);
+      } else {
+        pending.push_back({partial_score, row_, height});
+      }
+    }
+    ++row_;
+  }
+
+  // Resolves trees that see all the way to the bottom edge
+  void finish() {
+    for (std::size_t col{}; col < cols_; ++col) {
+      for (const Pending& tree : pending_[col]) {
+        best_.consider(tree.partial_score * (row_ - 1 - tree.row), tree.row,
+                       col);
+      }
+      pending_[col].clear();
     }
-    if (height > max_height) {
-      max_height = height;
-      visible_heights.insert(max_height);
+  }
+
+  std::uint64_t max_score() const { return best_.max_score(); }
+
+  // The best trees, best first
+  std::vector<ScoredTree> top() const { return best_.top(); }
+
+ private:
+  struct Blocker {
+    std::size_t row;
+    Height height;
+  };
+
+  struct Pending {
+    // Product of the up, left and right distances
+    std::uint64_t partial_score;
+    std::size_t row;
+    Height height;
+  };
+
+  std::size_t cols_;
+  std::size_t row_{};
+  TopTrees best_;
+  // Product of the left and right distances for the current row
+  std::vector<std::uint64_t> left_right_;
+  std::vector<std::size_t> row_stack_{};
+  std::vector<std::vector<Blocker>> blockers_;
+  std::vector<std::vector<Pending>> pending_;
+};
+
+struct ScenicResult {
+  std::uint64_t max_score;
+  // The best trees, best first
+  std::vector<ScoredTree> top;
+};
+
+// Scores the grid in column strips, one scorer per strip. A first pass over
+// row bands records, for every row, the seeds each strip needs from outside
+// its bounds. Each strip then reports its own best, and those are merged once
+// every thread is done.
+template <typename Height, std::size_t Radix>
+  requires(Radix > 0)
+ScenicResult score_strips(const Grid<Height, Radix>& grid,
+                          const std::size_t num_threads,
+                          const std::size_t top_k) {
+  using Seed = typename ScenicScorer<Radix>::Seed;
+  const auto strips = split_range(grid.cols(), num_threads, 1);
+  const std::size_t num_strips = strips.size() - 1;
+
+  // Per row and strip, what the strip's left and right ends see beyond it
+  std::vector<Seed> left_seeds;
+  std::vector<Seed> right_seeds;
+  if (num_strips > 1) {
+    left_seeds.resize(grid.rows() * num_strips);
+    right_seeds.resize(grid.rows() * num_strips);
+    const auto bands = split_range(grid.rows(), num_threads, 1);
+    parallel_for(num_threads, bands.size() - 1, [&](const std::size_t band) {
+      for (std::size_t row{bands[band]}; row < bands[band + 1]; ++row) {
+        const Height* const heights = grid.row(row);
+        Seed last{};
+        for (std::size_t strip{}; strip < num_strips; ++strip) {
+          left_seeds[row * num_strips + strip] = last;
+          for (std::size_t col{strips[strip]}; col < strips[strip + 1];
+               ++col) {
+            std::fill_n(last.begin(), heights[col] + 1, col);
+          }
+        }
+        last.fill(static_cast<std::uint32_t>(grid.cols() - 1));
+        for (std::size_t strip{num_strips}; strip-- > 0;) {
+          right_seeds[row * num_strips + strip] = last;
+          for (std::size_t col{strips[strip + 1]}; col-- > strips[strip];) {
+            std::fill_n(last.begin(), heights[col] + 1, col);
+          }
+        }
+      }
+    });
+  }
+
+  std::vector<ScenicResult> results(num_strips);
+  parallel_for(num_threads, num_strips, [&](const std::size_t strip) {
+    ScenicScorer<Radix> scorer{grid.cols(), top_k, strips[strip],
+                               strips[strip + 1]};
+    for (std::size_t row{}; row < grid.rows(); ++row) {
+      if (num_strips > 1) {
+        scorer.add_row(grid.row(row), &left_seeds[row * num_strips + strip],
+                       &right_seeds[row * num_strips + strip]);
+      } else {
+        scorer.add_row(grid.row(row));
+      }
     }
+    scorer.finish();
+    results[strip] = {scorer.max_score(), scorer.top()};
+  });
+
+  ScenicResult merged{};
+  for (const auto& result : results) {
+    merged.max_score = std::max(merged.max_score, result.max_score);
+    merged.top.insert(merged.top.end(), result.top.cbegin(),
+                      result.top.cend());
   }
-  auto last_visible = std::find_if(
-      range.cbegin(), range.cend(),
-      [max_height](const BaseT& tree) { return tree.height == max_height; });
+  std::sort(merged.top.begin(), merged.top.end(),
+            std::greater<ScoredTree>{});
+  merged.top.resize(std::min(merged.top.size(), top_k));
+  return merged;
+}
 
-  std::size_t num_visible;
-  if (last_visible == range.cend()) {
-    num_visible = range.size();
+// Without a radix the stack scorer has no compact seeds to hand a strip, so
+// such grids are scored as a single strip
+template <typename Height, std::size_t Radix>
+ScenicResult score_trees(const Grid<Height, Radix>& grid,
+                         const std::size_t num_threads = 1,
+                         const std::size_t top_k = 0) {
+  if constexpr (Radix > 0) {
+    return score_strips(grid, num_threads, top_k);
   } else {
-    num_visible = std::distance(range.cbegin(), std::next(last_visible));
+    StackScenicScorer<Height> scorer{grid.cols(), top_k};
+    for (std::size_t row{}; row < grid.rows(); ++row) {
+      scorer.add_row(grid.row(row));
+    }
+    scorer.finish();
+    return {scorer.max_score(), scorer.top()};
   }
+}
+
+enum class Direction : std::uint8_t { up, down, left, right };
+
+constexpr const std::array<Direction, 4> directions{
+    Direction::up, Direction::down, Direction::left, Direction::right};
 
-  ranges::for_each(
-      range | ranges::views::take(num_visible) |
-          ranges::views::filter([&visible_heights](const BaseT& tree) {
-            if (!visible_heights.contains(tree.height)) {
-              return false;
-            }
-            visible_heights.erase(std::find(
-                visible_heights.cbegin(), visible_heights.cend(), tree.height));
-            return true;
-          }) |
-          ranges::views::unique(std::equal_to<BaseT>{}),
-      Tree::set_visibility<true>{});
-  ranges::for_each(range | ranges::views::drop(num_visible),
-                   Tree::set_visibility<false>{});
+std::ostream& operator<<(std::ostream& os, const Direction direction) {
+  constexpr const std::array<std::string_view, 4> names{"up", "down", "left",
+                                                        "right"};
+  os << names[static_cast<std::size_t>(direction)];
+  return os;
 }
 
-template <typename T>
-void mark_visible(std::vector<T>& range) {
-  using BaseT = std::remove_cvref_t<typename T::type>;
+// Everything known about one tree: the directions it's visible from and how
+// far it sees in each
+struct TreeReport {
+  std::size_t row;
+  std::size_t col;
+  // Bit `d` is set when the tree is visible looking in from direction `d`
+  std::uint8_t visible_from;
+  std::array<std::size_t, 4> distances;
 
-  std::vector<std::reference_wrapper<BaseT>> reversed_range;
-  std::copy(range.rbegin(), range.rend(), std::back_inserter(reversed_range));
+  bool visible(const Direction direction) const {
+    return (visible_from >> static_cast<int>(direction)) & 1;
+  }
+  std::size_t distance(const Direction direction) const {
+    return distances[static_cast<std::size_t>(direction)];
+  }
+  std::uint64_t score() const {
+    return std::uint64_t{distances[0]} * distances[1] * distances[2] *
+           distances[3];
+  }
+};
 
-  mark_visible_impl(range);
-  mark_visible_impl(reversed_range);
+std::ostream& operator<<(std::ostream& os, const TreeReport& report) {
+  os << '(' << report.row << ',' << report.col << "): visible from";
+  bool any{false};
+  for (const Direction direction : directions) {
+    if (report.visible(direction)) {
+      os << (any ? "," : " ") << direction;
+      any = true;
+    }
+  }
+  if (!any) {
+    os << " nowhere";
+  }
+  os << "; sees";
+  for (const Direction direction : directions) {
+    os << ' ' << direction << '=' << report.distance(direction);
+  }
+  os << "; score " << report.score();
+  return os;
 }
 
-int main() {
-  std::vector<std::vector<Tree>> grid;
+// The maximum of an array of scores, kept current under point updates in
+// O(log n) each by a segment tree over the array
+class MaxTree {
+ public:
+  explicit MaxTree(const std::size_t size)
+      : leaves_{std::bit_ceil(std::max<std::size_t>(size, 1))},
+        nodes_(2 * leaves_) {}
 
-  if (std::ifstream ifs{"input"}; ifs.is_open()) {
-    for (std::string line; std::getline(ifs, line);) {
-      std::vector<Tree> row;
-      std::transform(line.cbegin(), line.cend(), std::back_inserter(row),
-                     [](const auto height) -> Tree {
-                       constexpr const char zero = '0';
-                       return {static_cast<std::size_t>(height - zero)};
-                     });
-      grid.push_back(row);
-    }
-  }
-
-  // rows - from left, from right
-  for (auto& row : grid) {
-    mark_visible(row);
-  }
-
-  // cols - from up, from down
-  for (std::size_t col_idx{}; col_idx < grid[0].size(); ++col_idx) {
-    std::vector<std::reference_wrapper<Tree>> col;
-    for (std::size_t row_idx{}; row_idx < grid.size(); ++row_idx) {
-      col.push_back(grid[row_idx][col_idx]);
-    }
-    mark_visible(col);
-  }
-
-  const std::size_t visible_trees = std::accumulate(
-      grid.cbegin(), grid.cend(), 0,
-      [](const std::size_t init, const auto& row) {
-        return init + std::accumulate(
-                          row.cbegin(), row.cend(), 0,
-                          [](const std::size_t init, const auto& tree) {
-                            return init +
-                                   (tree.maybe_visible.value_or(false) ? 1 : 0);
-                          });
-      });
-  std::cout << "Problem 1: " << visible_trees << '\n';
-
-  std::vector<std::size_t> scenic_scores;
-  for (int row{1}; row < static_cast<int>(grid.size()) - 1; ++row) {
-    for (int col{1}; col < static_cast<int>(grid[row].size()) - 1; ++col) {
-      std::size_t height{grid[row][col].height};
-
-      // up
-      std::size_t up_score{1};
-      for (int it_row{row - 1};
-           it_row >= 0 && grid[it_row][col].height < height;
-           --it_row, ++up_score) {
-        if (it_row == 0) {
-          --up_score;
+  // Sets every score at once, in O(n)
+  template <typename Score>
+  void assign(const std::size_t size, const Score& score) {
+    for (std::size_t index{}; index < size; ++index) {
+      nodes_[leaves_ + index] = score(index);
+    }
+    for (std::size_t node{leaves_}; node-- > 1;) {
+      nodes_[node] = std::max(nodes_[2 * node], nodes_[2 * node + 1]);
+    }
+  }
+
+  std::uint64_t get(const std::size_t index) const {
+    return nodes_[leaves_ + index];
+  }
+  void set(const std::size_t index, const std::uint64_t score) {
+    std::size_t node = leaves_ + index;
+    nodes_[node] = score;
+    for (node /= 2; node > 0; node /= 2) {
+      nodes_[node] = std::max(nodes_[2 * node], nodes_[2 * node + 1]);
+    }
+  }
+
+  std::uint64_t max() const { return nodes_[1]; }
+  // The first index holding the maximum
+  std::size_t argmax() const {
+    std::size_t node{1};
+    while (node < leaves_) {
+      node = nodes_[2 * node] == nodes_[node] ? 2 * node : 2 * node + 1;
+    }
+    return node - leaves_;
+  }
+
+ private:
+  std::size_t leaves_;
+  // Node `n` covers its children `2n` and `2n + 1`; leaves start at `leaves_`
+  std::vector<std::uint64_t> nodes_;
+};
+
+// Precomputes, for every tree, the directions it's visible from and its four
+// viewing distances, so that any tree can be looked up in constant time. Each
+// tree costs one byte of direction bits and four 16-bit distances. Longer
+// distances saturate, and the rare query that meets one walks the grid to
+// recover it.
+//
+// Heights may change afterwards. A tree's lines of sight only ever cross its
+// own row and column, so an update sweeps just those two lines again, and a
+// segment tree over every scenic score keeps the best one current as the
+// scores along them change.
+template <typename Height, std::size_t Radix>
+class TreeIndex {
+ public:
+  explicit TreeIndex(Grid<Height, Radix>& grid,
+                     const std::size_t num_threads = 1)
+      : grid_{grid},
+        visible_from_(grid.rows() * grid.cols()),
+        distances_(grid.rows() * grid.cols()),
+        scores_{grid.rows() * grid.cols()} {
+    const auto bands = split_range(grid.rows(), num_threads, 1);
+    parallel_for(num_threads, bands.size() - 1, [&](const std::size_t band) {
+      std::vector<std::size_t> stack;
+      for (std::size_t row{bands[band]}; row < bands[band + 1]; ++row) {
+        sweep(stack, grid.cols(), Direction::left, grid.row(row), 1,
+              row * grid.cols(), 1);
+      }
+    });
+    const auto strips = split_range(grid.cols(), num_threads, 1);
+    parallel_for(num_threads, strips.size() - 1, [&](const std::size_t strip) {
+      std::vector<std::size_t> stack;
+      for (std::size_t col{strips[strip]}; col < strips[strip + 1]; ++col) {
+        sweep(stack, grid.rows(), Direction::up, grid.row(0) + col,
+              grid.stride(), col, grid.cols());
+      }
+    });
+    num_visible_ = static_cast<std::size_t>(
+        visible_from_.size() -
+        std::count(visible_from_.cbegin(), visible_from_.cend(), 0));
+    scores_.assign(visible_from_.size(), [this](const std::size_t cell) {
+      return query(cell / grid_.cols(), cell % grid_.cols()).score();
+    });
+  }
+
+  std::size_t num_visible() const { return num_visible_; }
+  // The most scenic tree, the first in row-major order on a tie
+  ScoredTree best() const {
+    const std::size_t cell = scores_.argmax();
+    return {scores_.max(), cell / grid_.cols(), cell % grid_.cols()};
+  }
+
+  // Changes the height of the tree at (`row`, `col`), which must be within
+  // the grid, in O(rows + cols + (rows + cols) log(rows x cols)) time
+  void set_height(const std::size_t row, const std::size_t col,
+                  const Height height) {
+    const std::size_t cols = grid_.cols();
+    const std::size_t rows = grid_.rows();
+    const auto for_each_cell = [&](const auto& visit) {
+      for (std::size_t c{}; c < cols; ++c) {
+        visit(row * cols + c);
+      }
+      for (std::size_t r{}; r < rows; ++r) {
+        if (r != row) {
+          visit(r * cols + col);
         }
       }
+    };
+    for_each_cell([this](const std::size_t cell) {
+      num_visible_ -= visible_from_[cell] != 0;
+    });
+
+    grid_.set_height(row, col, height);
+    std::vector<std::size_t> stack;
+    sweep(stack, cols, Direction::left, grid_.row(row), 1, row * cols, 1);
+    sweep(stack, rows, Direction::up, grid_.row(0) + col, grid_.stride(), col,
+          cols);
+
+    for_each_cell([this](const std::size_t cell) {
+      num_visible_ += visible_from_[cell] != 0;
+      const std::uint64_t score =
+          query(cell / grid_.cols(), cell % grid_.cols()).score();
+      if (score != scores_.get(cell)) {
+        scores_.set(cell, score);
+      }
+    });
+  }
+
+  bool contains(const std::size_t row, const std::size_t col) const {
+    return row < grid_.rows() && col < grid_.cols();
+  }
+
+  // The tree at (`row`, `col`), which must be within the grid
+  TreeReport query(const std::size_t row, const std::size_t col) const {
+    const std::size_t cell = row * grid_.cols() + col;
+    TreeReport report{row, col, visible_from_[cell], {}};
+    for (const Direction direction : directions) {
+      const std::size_t index = static_cast<std::size_t>(direction);
+      report.distances[index] = distances_[cell][index];
+      if (report.distances[index] == saturated) {
+        report.distances[index] = walk(row, col, direction);
+      }
+    }
+    return report;
+  }
+
+ private:
+  static constexpr const std::size_t saturated =
+      std::numeric_limits<std::uint16_t>::max();
+
+  // Fills in one line of `size` trees, the i-th of which is at
+  // `heights[i * height_step]` and is cell `first_cell + i * cell_step`,
+  // looking in from `near` and from the opposite side. A stack of the trees
+  // that could still block the view yields the distance towards each side,
+  // and the tree is visible from that side when the stack empties.
+  void sweep(std::vector<std::size_t>& stack, const std::size_t size,
+             const Direction near, const Height* const heights,
+             const std::size_t height_step, const std::size_t first_cell,
+             const std::size_t cell_step) {
+    const std::size_t near_index = static_cast<std::size_t>(near);
+    const auto record = [&](const std::size_t position,
+                            const std::size_t index, const std::size_t edge) {
+      const Height height = heights[position * height_step];
+      while (!stack.empty() && heights[stack.back() * height_step] < height) {
+        stack.pop_back();
+      }
+      const std::size_t blocker = stack.empty() ? edge : stack.back();
+      const std::size_t distance =
+          blocker > position ? blocker - position : position - blocker;
+      const std::size_t cell = first_cell + position * cell_step;
+      distances_[cell][index] =
+          static_cast<std::uint16_t>(std::min(distance, saturated));
+      const std::uint8_t bit = std::uint8_t{1} << index;
+      visible_from_[cell] = stack.empty() ? visible_from_[cell] | bit
+                                          : visible_from_[cell] & ~bit;
+      stack.push_back(position);
+    };
 
-      // down
-      std::size_t down_score{1};
-      for (int it_row{row + 1}; it_row < static_cast<int>(grid.size()) &&
-                                grid[it_row][col].height < height;
-           ++it_row, ++down_score) {
-        if (it_row == static_cast<int>(grid.size()) - 1) {
-          --down_score;
+    stack.clear();
+    for (std::size_t position{}; position < size; ++position) {
+      record(position, near_index, 0);
+    }
+    // The opposite side always follows its near side
+    stack.clear();
+    for (std::size_t position{size}; position-- > 0;) {
+      record(position, near_index + 1, size - 1);
+    }
+  }
+
+  // Measures a viewing distance tree by tree
+  std::size_t walk(std::size_t row, std::size_t col,
+                   const Direction direction) const {
+    const Height height = grid_.height(row, col);
+    for (std::size_t distance{1};; ++distance) {
+      switch (direction) {
+        case Direction::up:
+          if (row-- == 0) {
+            return distance - 1;
+          }
+          break;
+        case Direction::down:
+          if (++row == grid_.rows()) {
+            return distance - 1;
+          }
+          break;
+        case Direction::left:
+          if (col-- == 0) {
+            return distance - 1;
+          }
+          break;
+        case Direction::right:
+          if (++col == grid_.cols()) {
+            return distance - 1;
+          }
+          break;
+      }
+      if (grid_.height(row, col) >= height) {
+        return distance;
+      }
+    }
+  }
+
+  Grid<Height, Radix>& grid_;
+  std::size_t num_visible_{};
+  std::vector<std::uint8_t> visible_from_;
+  std::vector<std::array<std::uint16_t, 4>> distances_;
+  MaxTree scores_;
+};
+
+// Whether `height` can stand in a grid: below the radix if the grid has one,
+// and otherwise within the range of `Height`
+template <typename Height, std::size_t Radix>
+bool fits_grid(const Level<Height> height) {
+  if constexpr (Radix > 0) {
+    return height >= 0 && height < static_cast<Level<Height>>(Radix);
+  } else {
+    return height >= std::numeric_limits<Height>::lowest() &&
+           height <= std::numeric_limits<Height>::max();
+  }
+}
+
+// Answers one query per line of `is`, each a row and column separated by a
+// comma or whitespace. A third number instead sets the height of that tree
+// and reports both answers afresh; a height the grid can't hold is rejected.
+template <typename Height, std::size_t Radix>
+void answer_queries(TreeIndex<Height, Radix>& index, std::istream& is) {
+  for (std::string line; std::getline(is, line);) {
+    std::replace(line.begin(), line.end(), ',', ' ');
+    std::istringstream iss{line};
+    std::size_t row{};
+    std::size_t col{};
+    // Read wide, so that byte heights aren't taken for characters
+    Level<Height> height{};
+    if (!(iss >> row >> col)) {
+      if (!line.empty()) {
+        std::cout << "Malformed query: " << line << '\n';
+      }
+    } else if (!index.contains(row, col)) {
+      std::cout << '(' << row << ',' << col << "): outside the grid\n";
+    } else if (iss >> std::ws; iss.eof()) {
+      std::cout << index.query(row, col) << '\n';
+    } else if (!(iss >> height) || !fits_grid<Height, Radix>(height)) {
+      std::cout << "Malformed query: " << line << '\n';
+    } else {
+      index.set_height(row, col, static_cast<Height>(height));
+      std::cout << '(' << row << ',' << col << ") set to " << height << ": "
+                << index.num_visible() << " visible, best " << index.best()
+                << '\n';
+    }
+  }
+}
+
+// Solves both parts straight from a mapped input file of any size, reading
+// it in bands of rows with memory bounded by the width of the grid rather
+// than its height. A first, top-down pass runs the scenic scorer, which only
+// ever holds per-column state, and records where each column's running
+// maximum rises; with ten heights, that staircase has at most ten steps. A
+// second, bottom-up pass then knows, for every tree, the tallest tree above
+// it from the staircase and the tallest below it from its own running
+// maxima, so it can count visible trees exactly.
+class StreamingForest {
+ public:
+  StreamingForest(const MappedFile& file, const std::size_t band_rows)
+      : file_{file}, band_rows_{std::max<std::size_t>(band_rows, 1)} {
+    const std::string_view contents = file_.contents();
+    cols_ = std::min(contents.find('\n'), contents.size());
+    // Every line holds `cols_` digits and a newline, bar perhaps the last
+    row_bytes_ = cols_ + 1;
+    rows_ = (contents.size() + 1) / row_bytes_;
+  }
+
+  std::size_t rows() const { return rows_; }
+  std::size_t cols() const { return cols_; }
+
+  ScenicResult solve(const std::size_t top_k = 0) {
+    ScenicScorer<DigitGrid::radix> scorer{cols_, top_k};
+    std::vector<int> max_heights(cols_, below_ground<std::uint8_t>);
+    std::vector<std::uint32_t> num_steps(cols_);
+    // Per column, the rows at which the running maximum rises, and to what
+    std::vector<std::uint32_t> step_rows(cols_ * DigitGrid::radix);
+    std::vector<std::uint8_t> step_heights(cols_ * DigitGrid::radix);
+
+    for_each_row(true, [&](const std::size_t row,
+                           const std::uint8_t* const heights) {
+      scorer.add_row(heights);
+      for (std::size_t col{}; col < cols_; ++col) {
+        if (heights[col] > max_heights[col]) {
+          max_heights[col] = heights[col];
+          const std::size_t step =
+              col * DigitGrid::radix + num_steps[col]++;
+          step_rows[step] = static_cast<std::uint32_t>(row);
+          step_heights[step] = heights[col];
+        }
+      }
+    });
+    scorer.finish();
+
+    std::size_t num_visible{};
+    std::fill(max_heights.begin(), max_heights.end(),
+              below_ground<std::uint8_t>);
+    std::vector<bool> row_visible(cols_);
+    for_each_row(false, [&](const std::size_t row,
+                            const std::uint8_t* const heights) {
+      int row_max = below_ground<std::uint8_t>;
+      for (std::size_t col{}; col < cols_; ++col) {
+        row_visible[col] = heights[col] > row_max;
+        row_max = std::max<int>(row_max, heights[col]);
+      }
+      row_max = below_ground<std::uint8_t>;
+      for (std::size_t col{cols_}; col-- > 0;) {
+        if (heights[col] > row_max) {
+          row_visible[col] = true;
+          row_max = heights[col];
         }
       }
 
-      // left
-      std::size_t left_score{1};
-      for (int it_col{col - 1};
-           it_col >= 0 && grid[row][it_col].height < height;
-           --it_col, ++left_score) {
-        if (it_col == 0) {
-          --left_score;
+      for (std::size_t col{}; col < cols_; ++col) {
+        // Rows only decrease, so drop steps at or below this one
+        std::uint32_t& steps = num_steps[col];
+        const std::size_t first_step = col * DigitGrid::radix;
+        while (steps > 0 && step_rows[first_step + steps - 1] >= row) {
+          --steps;
         }
+        const int max_above =
+            steps > 0 ? step_heights[first_step + steps - 1]
+                      : below_ground<std::uint8_t>;
+        num_visible += row_visible[col] || heights[col] > max_above ||
+                       heights[col] > max_heights[col];
+        max_heights[col] = std::max<int>(max_heights[col], heights[col]);
       }
+    });
+    num_visible_ = num_visible;
+    return {scorer.max_score(), scorer.top()};
+  }
 
-      // right
-      std::size_t right_score{1};
-      for (int it_col{col + 1}; it_col < static_cast<int>(grid[row].size()) &&
-                                grid[row][it_col].height < height;
-           ++it_col, ++right_score) {
-        if (it_col == static_cast<int>(grid[row].size()) - 1) {
-          --right_score;
+  std::size_t num_visible() const { return num_visible_; }
+
+ private:
+  // Decodes rows top-down (or bottom-up) one band at a time, releasing each
+  // band's pages once it's done
+  template <typename Visit>
+  void for_each_row(const bool downward, const Visit& visit) const {
+    constexpr const char zero = '0';
+    const char* const data = file_.contents().data();
+    std::vector<std::uint8_t> heights(cols_);
+    for (std::size_t band{}; band * band_rows_ < rows_; ++band) {
+      const std::size_t band_begin =
+          downward ? band * band_rows_
+                   : rows_ - std::min(rows_, (band + 1) * band_rows_);
+      const std::size_t band_end =
+          downward ? std::min(rows_, band_begin + band_rows_)
+                   : rows_ - band * band_rows_;
+      for (std::size_t step{}; step < band_end - band_begin; ++step) {
+        const std::size_t row = downward ? band_begin + step
+                                         : band_end - 1 - step;
+        const char* const line = data + row * row_bytes_;
+        for (std::size_t col{}; col < cols_; ++col) {
+          heights[col] = static_cast<std::uint8_t>(line[col] - zero);
         }
+        visit(row, heights.data());
       }
+      file_.release(band_begin * row_bytes_,
+                    std::min(file_.contents().size(), band_end * row_bytes_));
+    }
+  }
+
+  const MappedFile& file_;
+  std::size_t band_rows_;
+  std::size_t rows_{};
+  std::size_t cols_{};
+  std::size_t row_bytes_{};
+  std::size_t num_visible_{};
+};
 
-      const std::size_t scenic_score =
-          up_score * down_score * left_score * right_score;
-      scenic_scores.push_back(scenic_score);
+// Times both parts on a random `size` x `size` grid for 1, 2, 4, ... up to
+// `max_threads` threads, checking every run against the single-threaded one
+bool run_benchmark(const std::size_t size, const std::size_t max_threads) {
+  using Clock = std::chrono::steady_clock;
+  DigitGrid grid;
+  {
+    std::mt19937 rng{size};
+    std::uniform_int_distribution<int> digit{'0', '9'};
+    std::string line(size, '0');
+    for (std::size_t row{}; row < size; ++row) {
+      std::generate(line.begin(), line.end(),
+                    [&] { return static_cast<char>(digit(rng)); });
+      grid.append_row(line);
+    }
+  }
+
+  bool verified{true};
+  double base_ms{};
+  std::size_t base_visible{};
+  std::uint64_t base_score{};
+  for (std::size_t num_threads{1};; num_threads *= 2) {
+    num_threads = std::min(num_threads, max_threads);
+    DigitGrid run = grid;
+    const auto start = Clock::now();
+    mark_visible(run, num_threads);
+    const std::uint64_t score = score_trees(run, num_threads).max_score;
+    const double ms =
+        std::chrono::duration<double, std::milli>(Clock::now() - start)
+            .count();
+    if (num_threads == 1) {
+      base_ms = ms;
+      base_visible = run.num_visible();
+      base_score = score;
+    }
+    verified &= run.num_visible() == base_visible && score == base_score;
+    std::cout << num_threads << " threads: " << ms << " ms, speedup "
+              << base_ms / ms << "x\n";
+    if (num_threads == max_threads) {
+      break;
+    }
+  }
+  std::cout << (verified ? "verified" : "MISMATCH") << '\n';
+  return verified;
+}
+
+// Prints both answers, then answers any queries and updates from `query_path`
+// (or from standard input if it's "-")
+template <typename Height, std::size_t Radix>
+void print_answers(Grid<Height, Radix>& grid, const std::size_t num_threads,
+                   const std::size_t top_k,
+                   const char* const query_path = nullptr) {
+  mark_visible(grid, num_threads);
+  std::cout << "Problem 1: " << grid.num_visible() << '\n';
+
+  const ScenicResult result = score_trees(grid, num_threads, top_k);
+  std::cout << "Problem 2: " << result.max_score << '\n';
+  for (const auto& tree : result.top) {
+    std::cout << tree << '\n';
+  }
+
+  if (query_path != nullptr) {
+    TreeIndex index{grid, num_threads};
+    if (std::string_view{query_path} == "-") {
+      answer_queries(index, std::cin);
+    } else if (std::ifstream ifs{query_path}; ifs.is_open()) {
+      answer_queries(index, ifs);
+    }
+  }
+}
+
+// Solves a terrain of `Height`s from a CSV or binary raster file
+template <typename Height>
+bool solve_terrain(const char* const path, const bool raster,
+                   const std::size_t num_threads, const std::size_t top_k,
+                   const char* const query_path) {
+  const MappedFile file{path};
+  if (!file.is_open()) {
+    return false;
+  }
+  Grid<Height> grid;
+  if (!(raster ? load_raster(file.contents(), grid)
+               : load_csv(file.contents(), grid))) {
+    std::cerr << "Malformed terrain in " << path << '\n';
+    return false;
+  }
+  print_answers(grid, num_threads, top_k, query_path);
+  return true;
+}
+
+int main(int argc, char* argv[]) {
+  // `--top K` also lists the K most scenic trees, `--threads N` splits the
+  // work across N threads and `--bench SIZE` times a random SIZE x SIZE grid
+  // on up to N threads instead of solving the puzzle. `--stream` solves from
+  // the mapped input in bands of rows (`--band-rows N` of them) instead of
+  // loading the whole grid. `--csv PATH` and `--raster PATH` solve a terrain
+  // of `--type u8|u16|f32` heights (u16 by default) instead of the input.
+  // `--query PATH|-` then reports on the trees at the listed coordinates.
+  std::size_t top_k{};
+  std::size_t num_threads{1};
+  std::size_t bench_size{};
+  bool stream{false};
+  std::size_t band_rows{4096};
+  const char* terrain_path{nullptr};
+  bool raster{false};
+  std::string_view type{"u16"};
+  const char* query_path{nullptr};
+  for (int arg{1}; arg < argc; ++arg) {
+    stream |= std::string_view{argv[arg]} == "--stream";
+  }
+  for (int arg{1}; arg + 1 < argc; ++arg) {
+    const std::string_view option{argv[arg]};
+    if (option == "--top") {
+      top_k = std::stoul(argv[++arg]);
+    } else if (option == "--threads") {
+      num_threads = std::max<std::size_t>(1, std::stoul(argv[++arg]));
+    } else if (option == "--bench") {
+      bench_size = std::stoul(argv[++arg]);
+    } else if (option == "--band-rows") {
+      band_rows = std::stoul(argv[++arg]);
+    } else if (option == "--csv" || option == "--raster") {
+      raster = option == "--raster";
+      terrain_path = argv[++arg];
+    } else if (option == "--type") {
+      type = argv[++arg];
+    } else if (option == "--query") {
+      query_path = argv[++arg];
+    }
+  }
+
+  if (bench_size > 0) {
+    return run_benchmark(bench_size, num_threads) ? 0 : 1;
+  }
+
+  if (terrain_path != nullptr) {
+    bool solved{false};
+    if (type == "u8") {
+      solved = solve_terrain<std::uint8_t>(terrain_path, raster, num_threads,
+                                           top_k, query_path);
+    } else if (type == "u16") {
+      solved = solve_terrain<std::uint16_t>(terrain_path, raster, num_threads,
+                                            top_k, query_path);
+    } else if (type == "f32") {
+      solved = solve_terrain<float>(terrain_path, raster, num_threads, top_k,
+                                    query_path);
+    } else {
+      std::cerr << "Unknown height type " << type << '\n';
+    }
+    return solved ? 0 : 1;
+  }
+
+  if (stream) {
+    const MappedFile input{"input"};
+    if (!input.is_open()) {
+      return 1;
+    }
+    StreamingForest forest{input, band_rows};
+    const ScenicResult result = forest.solve(top_k);
+    std::cout << "Problem 1: " << forest.num_visible() << '\n';
+    std::cout << "Problem 2: " << result.max_score << '\n';
+    for (const auto& tree : result.top) {
+      std::cout << tree << '\n';
+    }
+    return 0;
+  }
+
+  DigitGrid grid;
+
+  if (std::ifstream ifs{"input"}; ifs.is_open()) {
+    for (std::string line; std::getline(ifs, line);) {
+      grid.append_row(line);
     }
   }
 
-  const auto max_scenic_score =
-      *std::max_element(scenic_scores.cbegin(), scenic_scores.cend());
-  std::cout << "Problem 2: " << max_scenic_score << '\n';
+  print_answers(grid, num_threads, top_k, query_path);
 }
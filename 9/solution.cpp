@@ -1,17 +1,29 @@
+#include <malloc.h>
+
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <bit>
 #include <boost/container_hash/hash.hpp>
+#include <charconv>
+#include <chrono>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <fstream>
 #include <functional>
 #include <iostream>
-#include <iterator>
+#include <limits>
 #include <optional>
+#include <random>
+#include <sstream>
 #include <string>
-#include <tuple>
-#include <type_traits>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 namespace std {
 [[noreturn]] inline void unreachable() {
@@ -55,11 +67,10 @@ struct Motion {
     right = 'R',
   };
 
-  explicit Motion(const Motion::Direction direction_)
-      : direction{direction_}, magnitude{unit_magnitude} {}
+  explicit Motion(const Motion::Direction direction_,
+                  const std::size_t magnitude_ = unit_magnitude)
+      : direction{direction_}, magnitude{magnitude_} {}
 
-  static const constexpr std::size_t num_directions{4};
-  static const constexpr std::size_t num_diagonal_directions{2};
   static const constexpr std::size_t unit_magnitude{1};
 
   Direction direction;
@@ -71,189 +82,1072 @@ std::ostream& operator<<(std::ostream& os, const Motion& motion) {
   return os;
 }
 
-bool in_touch(const Point& point_1, const Point& point_2) {
-  return point_1.x >= point_2.x - 1 && point_1.x <= point_2.x + 1 &&
-         point_1.y >= point_2.y - 1 && point_1.y <= point_2.y + 1;
-}
-
-bool within_l1_distance_impl(const Point& lagging, const Point& leading,
-                             const std::size_t limit,
-                             const Motion::Direction direction) {
+// The offset of one unit of motion in `direction`
+Point unit_offset(const Motion::Direction direction) {
   switch (direction) {
     case Motion::Direction::up:
-      return (leading.y - lagging.y) == static_cast<int>(limit) &&
-             (leading.x == lagging.x);
-      break;
+      return {0, 1};
     case Motion::Direction::down:
-      return (lagging.y - leading.y) == static_cast<int>(limit) &&
-             (leading.x == lagging.x);
-      break;
+      return {0, -1};
     case Motion::Direction::right:
-      return (leading.x - lagging.x) == static_cast<int>(limit) &&
-             (leading.y == lagging.y);
-      break;
+      return {1, 0};
     case Motion::Direction::left:
-      return (lagging.x - leading.x) == static_cast<int>(limit) &&
-             (leading.y == lagging.y);
-      break;
+      return {-1, 0};
     default:
       std::unreachable();
   }
 }
 
-std::optional<Motion::Direction> direction_within_l1_distance(
-    const Point& lagging, const Point& leading, const std::size_t limit) {
-  const std::array<Motion::Direction, Motion::num_directions> directions{
-      Motion::Direction::up, Motion::Direction::down, Motion::Direction::left,
-      Motion::Direction::right};
-  std::array<bool, Motion::num_directions> directions_in_distance;
-  for (std::size_t index{}; index < directions.size(); ++index) {
-    const auto direction = directions[index];
-    const bool in_distance =
-        within_l1_distance_impl(lagging, leading, limit, direction);
-    directions_in_distance[index] = in_distance;
-  }
-  if (std::count(directions_in_distance.cbegin(), directions_in_distance.cend(),
-                 true) != 1) {
-    return {};
-  }
-  if (const auto it = std::find(directions_in_distance.cbegin(),
-                                directions_in_distance.cend(), true);
-      it != directions_in_distance.cend()) {
-    const std::size_t index =
-        std::distance(directions_in_distance.cbegin(), it);
-    return directions[index];
-  }
-  return {};
+// Where a knot at `lagging` moves to keep up with one at `leading`. It stays
+// put while the two touch, that is while their Chebyshev distance is at most
+// 1, and otherwise steps one unit towards `leading` along each axis on which
+// they differ. No branches and no allocation, just a few integer ops.
+Point follow_point(const Point& lagging, const Point& leading) {
+  const std::int32_t dx = leading.x - lagging.x;
+  const std::int32_t dy = leading.y - lagging.y;
+  const std::int32_t apart = (dx > 1) | (dx < -1) | (dy > 1) | (dy < -1);
+  return {lagging.x + apart * ((dx > 0) - (dx < 0)),
+          lagging.y + apart * ((dy > 0) - (dy < 0))};
 }
 
-std::array<Motion::Direction, Motion::num_diagonal_directions>
-find_diagonal_directions(const Point& lagging, const Point& leading) {
-  std::array<Motion::Direction, Motion::num_diagonal_directions>
-      diagonal_directions;
+namespace Rope {
+namespace Visits {
+// Records visited points in 64 x 64 tiles, each a 512-byte bitmap, kept in a
+// hash map so that memory follows the cells actually visited rather than
+// their bounding box. Tiles are keyed by the Morton code of their
+// coordinates, so nearby tiles get nearby keys, and the last tile touched is
+// kept at hand since a walk mostly stays within one. Clearing unlinks the
+// tiles and keeps up to `max_spare_tiles` of their nodes to reuse.
+class Tiled {
+ public:
+  explicit Tiled(const Point& start) { insert(start); }
+  // A copy has tiles of its own, so it starts without one at hand
+  Tiled(const Tiled& other) : tiles_{other.tiles_} {}
+  Tiled& operator=(const Tiled& other) {
+    tiles_ = other.tiles_;
+    tile_ = nullptr;
+    return *this;
+  }
+  Tiled(Tiled&&) = default;
+  Tiled& operator=(Tiled&&) = default;
 
-  diagonal_directions[0] =
-      (leading.y > lagging.y) ? Motion::Direction::up : Motion::Direction::down;
-  diagonal_directions[1] = (leading.x > lagging.x) ? Motion::Direction::right
-                                                   : Motion::Direction::left;
+  // Forgets every visit
+  void clear(const Point& start) {
+    while (!tiles_.empty() && spare_.size() < max_spare_tiles) {
+      spare_.push_back(tiles_.extract(tiles_.begin()));
+    }
+    tiles_.clear();
+    tile_ = nullptr;
+    insert(start);
+  }
 
-  return diagonal_directions;
-}
+  void insert(const Point& point) {
+    const std::uint32_t x = biased(point.x);
+    const std::uint32_t y = biased(point.y);
+    const std::uint64_t key = morton(x / tile_size, y / tile_size);
+    if (tile_ == nullptr || key != key_) {
+      key_ = key;
+      tile_ = &find_or_add(key);
+    }
+    (*tile_)[y % tile_size] |= std::uint64_t{1} << (x % tile_size);
+  }
+
+  // Visits `count` points in a line past `from`, each `offset` from the last
+  void insert_line(Point from, const Point& offset, const std::size_t count) {
+    for (std::size_t step{}; step < count; ++step) {
+      from = {from.x + offset.x, from.y + offset.y};
+      insert(from);
+    }
+  }
 
-std::vector<Motion> suggest_motion(const Point& lagging, const Point& leading) {
-  if (in_touch(lagging, leading)) {
-    return {};
+  std::size_t size() const {
+    std::size_t size{};
+    for (const auto& [key, tile] : tiles_) {
+      for (const std::uint64_t row : tile) {
+        size += std::popcount(row);
+      }
+    }
+    return size;
   }
 
-  // Not in touch, so figure out a motion that fixes this
-  constexpr std::size_t l1_distance_limit{2};
-  // If 2 units away in a given direction, just move 1 unit in that directiojn
-  if (const auto maybe_direction{
-          direction_within_l1_distance(lagging, leading, l1_distance_limit)}) {
-    return {Motion{*maybe_direction}};
+  std::size_t num_tiles() const { return tiles_.size(); }
+
+ private:
+  static constexpr const std::uint32_t tile_size{64};
+  // Enough for a 2048 x 2048 walk, at 512 bytes each
+  static constexpr const std::size_t max_spare_tiles{1024};
+
+  using Tile = std::array<std::uint64_t, tile_size>;
+  using Tiles = std::unordered_map<std::uint64_t, Tile>;
+
+  // The tile at `key`, taking a spare node for it if it's new
+  Tile& find_or_add(const std::uint64_t key) {
+    if (const auto it = tiles_.find(key); it != tiles_.end()) {
+      return it->second;
+    }
+    if (spare_.empty()) {
+      return tiles_[key];
+    }
+    Tiles::node_type node = std::move(spare_.back());
+    spare_.pop_back();
+    node.key() = key;
+    node.mapped().fill(0);
+    return tiles_.insert(std::move(node)).position->second;
   }
 
-  // Else, move diagonally
-  std::vector<Motion> suggested_diagonal_motions;
-  const auto diagonal_motion_directions =
-      find_diagonal_directions(lagging, leading);
-  std::transform(diagonal_motion_directions.cbegin(),
-                 diagonal_motion_directions.cend(),
-                 std::back_inserter(suggested_diagonal_motions),
-                 [](const auto direction) { return Motion{direction}; });
-  return suggested_diagonal_motions;
-}
+  // Shifts coordinates to be unsigned while keeping their order
+  static std::uint32_t biased(const std::int32_t coordinate) {
+    return static_cast<std::uint32_t>(coordinate) ^ 0x80000000u;
+  }
 
-namespace Rope {
-namespace Knot {
-struct Head;
-struct Middle;
-struct Tail;
-}  // namespace Knot
-
-template <typename EndType>
-class End {
+  // Interleaves the bits of `x` and `y`, `x` in the even bits
+  static std::uint64_t morton(const std::uint32_t x, const std::uint32_t y) {
+    const auto spread = [](std::uint64_t bits) {
+      bits = (bits | (bits << 16)) & 0x0000ffff0000ffffu;
+      bits = (bits | (bits << 8)) & 0x00ff00ff00ff00ffu;
+      bits = (bits | (bits << 4)) & 0x0f0f0f0f0f0f0f0fu;
+      bits = (bits | (bits << 2)) & 0x3333333333333333u;
+      bits = (bits | (bits << 1)) & 0x5555555555555555u;
+      return bits;
+    };
+    return spread(x) | (spread(y) << 1);
+  }
+
+  Tiles tiles_{};
+  // Tiles never move once inserted, even when the map itself is moved, so
+  // this stays valid
+  Tile* tile_{nullptr};
+  std::uint64_t key_{};
+  // Nodes unlinked by `clear`, for new tiles to reuse
+  std::vector<Tiles::node_type> spare_{};
+};
+
+// Records visited points in a bitmap over their bounding box, which grows to
+// fit wherever the walk drifts. Growth at least doubles the box along the
+// side that overflowed, so the copying amortises to a constant per visit.
+// The old bitmap is kept as scratch for the next growth, and clearing sizes
+// both to the largest box yet, so a later walk only allocates once its box
+// outgrows every earlier one.
+//
+// A walk that drifts far leaves most of its box unvisited, so once the box
+// would pass both `min_cap_words` and a word per visit, every visit moves
+// into `Tiled` tiles, which record the walk from then on.
+class Dense {
  public:
-  const Point& current_point() const { return current_; }
-  const std::unordered_set<Point>& points_visited() const {
-    return points_visited_;
+  explicit Dense(const Point& start)
+      : min_x_{start.x},
+        min_y_{start.y},
+        words_per_row_{1},
+        rows_{1},
+        bits_(1) {
+    insert(start);
+  }
+
+  // Forgets every visit, keeping the bitmap's memory for reuse
+  void clear(const Point& start) {
+    tiled_.reset();
+    min_x_ = start.x;
+    min_y_ = start.y;
+    words_per_row_ = 1;
+    rows_ = 1;
+    scratch_.clear();
+    scratch_.reserve(bits_.capacity());
+    bits_.assign(1, 0);
+    size_ = 0;
+    insert(start);
   }
 
-  void move(const Motion& motion, const bool should_track_visit =
-                                      std::is_same_v<EndType, Knot::Head>) {
-    switch (motion.direction) {
-      case Motion::Direction::up:
-        current_.y += motion.magnitude;
-        break;
-      case Motion::Direction::down:
-        current_.y -= motion.magnitude;
-        break;
-      case Motion::Direction::right:
-        current_.x += motion.magnitude;
-        break;
-      case Motion::Direction::left:
-        current_.x -= motion.magnitude;
-        break;
-      default:
-        std::unreachable();
+  void insert(const Point& point) {
+    if (!tiled_ && !contains_in_box(point) && !grow_to(point, 1)) {
+      move_to_tiles();
     }
+    if (tiled_) {
+      tiled_->insert(point);
+      return;
+    }
+    const std::size_t col = static_cast<std::size_t>(point.x - min_x_);
+    const std::size_t row = static_cast<std::size_t>(point.y - min_y_);
+    std::uint64_t& word = bits_[row * words_per_row_ + col / bits_per_word];
+    const std::uint64_t bit = std::uint64_t{1} << (col % bits_per_word);
+    size_ += (word & bit) == 0;
+    word |= bit;
+  }
 
-    if (should_track_visit) {
-      visit(current_);
+  // Visits `count` points in a line past `from`, each `offset` from the last
+  void insert_line(const Point& from, const Point& offset,
+                   const std::size_t count) {
+    if (count == 0) {
+      return;
+    }
+    const std::int64_t reach = static_cast<std::int64_t>(count);
+    const Point to{static_cast<std::int32_t>(from.x + offset.x * reach),
+                   static_cast<std::int32_t>(from.y + offset.y * reach)};
+    // Growing once for the far end covers the whole line
+    if (!tiled_ && !contains_in_box(to) && !grow_to(to, count)) {
+      move_to_tiles();
+    }
+    if (tiled_) {
+      tiled_->insert_line(from, offset, count);
+      return;
+    }
+    std::size_t col = static_cast<std::size_t>(from.x - min_x_);
+    std::size_t row = static_cast<std::size_t>(from.y - min_y_);
+    for (std::size_t step{}; step < count; ++step) {
+      col += offset.x;
+      row += offset.y;
+      std::uint64_t& word = bits_[row * words_per_row_ + col / bits_per_word];
+      const std::uint64_t bit = std::uint64_t{1} << (col % bits_per_word);
+      size_ += (word & bit) == 0;
+      word |= bit;
     }
   }
 
-  // Following is only a valid behavior for a non-head knot
-  template <typename U = void, typename = std::enable_if_t<
-                                   !std::is_same_v<EndType, Knot::Head>, U>>
-  void follow(const End<U>& end) {
-    for (const auto& motion : suggest_motion(current_, end.current_point())) {
-      move(motion);
+  std::size_t size() const { return tiled_ ? tiled_->size() : size_; }
+
+ private:
+  static constexpr const std::size_t bits_per_word{64};
+  // 2 MiB, which any box may grow to however few points it holds
+  static constexpr const std::size_t min_cap_words{std::size_t{1} << 18};
+
+  bool contains_in_box(const Point& point) const {
+    return point.x >= min_x_ && point.y >= min_y_ &&
+           static_cast<std::int64_t>(point.x) - min_x_ <
+               static_cast<std::int64_t>(words_per_row_ * bits_per_word) &&
+           static_cast<std::int64_t>(point.y) - min_y_ <
+               static_cast<std::int64_t>(rows_);
+  }
+
+  // Grows the box to take in `point`, ahead of `num_new` more visits, unless
+  // that would pass the cap
+  bool grow_to(const Point& point, const std::size_t num_new) {
+    const std::int64_t width = words_per_row_ * bits_per_word;
+    const std::int64_t height = rows_;
+    std::int64_t min_x = min_x_;
+    std::int64_t max_x = min_x_ + width;
+    std::int64_t min_y = min_y_;
+    std::int64_t max_y = min_y_ + height;
+    if (point.x < min_x) {
+      min_x = std::min<std::int64_t>(point.x, min_x - width);
+    } else if (point.x >= max_x) {
+      max_x = std::max<std::int64_t>(point.x + 1, max_x + width);
+    }
+    if (point.y < min_y) {
+      min_y = std::min<std::int64_t>(point.y, min_y - height);
+    } else if (point.y >= max_y) {
+      max_y = std::max<std::int64_t>(point.y + 1, max_y + height);
+    }
+    // Keep the old box on word boundaries, so rows copy a word at a time
+    const std::size_t words_left =
+        (static_cast<std::size_t>(min_x_ - min_x) + bits_per_word - 1) /
+        bits_per_word;
+    min_x = min_x_ - static_cast<std::int64_t>(words_left * bits_per_word);
+    const std::size_t words_per_row =
+        (static_cast<std::size_t>(max_x - min_x) + bits_per_word - 1) /
+        bits_per_word;
+    const std::size_t rows = static_cast<std::size_t>(max_y - min_y);
+    const std::size_t rows_below = static_cast<std::size_t>(min_y_ - min_y);
+    if (rows * words_per_row > std::max(min_cap_words, size_ + num_new)) {
+      return false;
+    }
+
+    scratch_.assign(rows * words_per_row, 0);
+    for (std::size_t row{}; row < rows_; ++row) {
+      std::copy_n(bits_.cbegin() + row * words_per_row_, words_per_row_,
+                  scratch_.begin() + (row + rows_below) * words_per_row +
+                      words_left);
+    }
+    bits_.swap(scratch_);
+    min_x_ = min_x;
+    min_y_ = min_y;
+    words_per_row_ = words_per_row;
+    rows_ = rows;
+    return true;
+  }
+
+  // Hands every visit so far to tiles, and the bitmap's memory back
+  void move_to_tiles() {
+    for (std::size_t index{}; index < bits_.size(); ++index) {
+      for (std::uint64_t word = bits_[index]; word != 0; word &= word - 1) {
+        const std::size_t col = index % words_per_row_ * bits_per_word +
+                                std::countr_zero(word);
+        const Point point{
+            static_cast<std::int32_t>(min_x_ + static_cast<std::int64_t>(col)),
+            static_cast<std::int32_t>(
+                min_y_ + static_cast<std::int64_t>(index / words_per_row_))};
+        if (tiled_) {
+          tiled_->insert(point);
+        } else {
+          tiled_.emplace(point);
+        }
+      }
     }
-    visit(current_);
+    bits_ = {};
+    scratch_ = {};
+  }
+
+  // The corner of the box nearest negative infinity
+  std::int64_t min_x_;
+  std::int64_t min_y_;
+  std::size_t words_per_row_;
+  std::size_t rows_;
+  std::vector<std::uint64_t> bits_;
+  // The bitmap before the last growth, only kept for its memory
+  std::vector<std::uint64_t> scratch_{};
+  std::size_t size_{};
+  // Every visit, once the box has passed its cap
+  std::optional<Tiled> tiled_{};
+};
+
+// Records visited points in a hash set, one node per point
+class Hashed {
+ public:
+  explicit Hashed(const Point& start) { insert(start); }
+
+  // Forgets every visit, freeing their nodes
+  void clear(const Point& start) {
+    points_.clear();
+    insert(start);
+  }
+
+  void insert(const Point& point) { points_.insert(point); }
+
+  // Visits `count` points in a line past `from`, each `offset` from the last
+  void insert_line(Point from, const Point& offset, const std::size_t count) {
+    for (std::size_t step{}; step < count; ++step) {
+      from = {from.x + offset.x, from.y + offset.y};
+      insert(from);
+    }
+  }
+
+  std::size_t size() const { return points_.size(); }
+
+ private:
+  std::unordered_set<Point> points_{};
+};
+}  // namespace Visits
+
+// Writes every knot's move at every step to a file, for `Replay` to read
+// back. A step records how many knots at the front of the rope it updated
+// (the rest stayed put) and then their moves, as 2-bit signs of x and y, two
+// knots to a byte. A run of steps sliding the whole straightened rope records
+// just its length and direction. Every `checkpoint_interval` steps or so the
+// position of every knot is kept too, and those go at the end of the file so
+// that a replay can start from the nearest.
+class Recorder {
+ public:
+  struct Header {
+    std::array<char, 8> magic;
+    std::uint64_t num_knots;
+    std::uint64_t num_steps;
+    std::uint64_t stream_size;
+    std::uint64_t num_checkpoints;
+  };
+
+  static constexpr const std::array<char, 8> magic{'R', 'O', 'P', 'E',
+                                                   'T', 'R', 'A', 'J'};
+
+  Recorder(const char* const path, const std::size_t num_knots,
+           const std::size_t checkpoint_interval)
+      : ofs_{path, std::ios::binary},
+        num_knots_{num_knots},
+        checkpoint_interval_{std::max<std::size_t>(checkpoint_interval, 1)} {
+    // The header is only known once recording finishes
+    const Header header{};
+    ofs_.write(reinterpret_cast<const char*>(&header), sizeof header);
+  }
+  Recorder(const Recorder&) = delete;
+  Recorder& operator=(const Recorder&) = delete;
+  ~Recorder() { finish(); }
+
+  bool is_open() const { return ofs_.is_open(); }
+
+  // Starts a step from the knots' current positions
+  void begin_step(const std::vector<Point>& knots) {
+    if (num_steps_ >= next_checkpoint_) {
+      checkpoint(knots);
+    }
+    moved_ = 0;
+    pending_.clear();
+  }
+  // Adds the move of the next knot, head first
+  void push(const Point& delta) {
+    const std::uint8_t signs =
+        static_cast<std::uint8_t>((delta.x + 1) | ((delta.y + 1) << 2));
+    if (moved_++ % 2 == 0) {
+      pending_.push_back(signs);
+    } else {
+      pending_.back() |= signs << 4;
+    }
+  }
+  void end_step() {
+    write_varint(moved_);
+    buffer_.insert(buffer_.end(), pending_.cbegin(), pending_.cend());
+    ++num_steps_;
+    flush_if_full();
+  }
+
+  // Records `count` steps on each of which every knot moves by `offset`
+  void slide(const std::vector<Point>& knots, const Point& offset,
+             const std::size_t count) {
+    if (num_steps_ >= next_checkpoint_) {
+      checkpoint(knots);
+    }
+    // No step updates no knots, so a zero marks a slide
+    write_varint(0);
+    write_varint(count);
+    buffer_.push_back(
+        static_cast<std::uint8_t>((offset.x + 1) | ((offset.y + 1) << 2)));
+    num_steps_ += count;
+    flush_if_full();
+  }
+
+  // Writes the checkpoints and the header; nothing may be recorded after
+  void finish() {
+    if (finished_ || !is_open()) {
+      return;
+    }
+    finished_ = true;
+    flush();
+    ofs_.write(reinterpret_cast<const char*>(checkpoints_.data()),
+               checkpoints_.size() * sizeof(std::uint64_t));
+    const Header header{magic, num_knots_, num_steps_, stream_size_,
+                        num_checkpoints_};
+    ofs_.seekp(0);
+    ofs_.write(reinterpret_cast<const char*>(&header), sizeof header);
+    ofs_.close();
   }
 
  private:
-  void visit(const Point& point) { points_visited_.insert(point); }
+  static constexpr const std::size_t buffer_limit{1 << 16};
+
+  // A checkpoint is the step, the offset into the stream, and then each knot
+  // as x and y packed into one word
+  void checkpoint(const std::vector<Point>& knots) {
+    checkpoints_.push_back(num_steps_);
+    checkpoints_.push_back(stream_size_ + buffer_.size());
+    for (const Point& knot : knots) {
+      checkpoints_.push_back(std::bit_cast<std::uint64_t>(knot));
+    }
+    ++num_checkpoints_;
+    next_checkpoint_ = num_steps_ + checkpoint_interval_;
+  }
 
-  Point current_{};
-  std::unordered_set<Point> points_visited_{current_};
+  void write_varint(std::uint64_t value) {
+    for (; value >= 0x80; value >>= 7) {
+      buffer_.push_back(static_cast<std::uint8_t>(value | 0x80));
+    }
+    buffer_.push_back(static_cast<std::uint8_t>(value));
+  }
+
+  void flush_if_full() {
+    if (buffer_.size() >= buffer_limit) {
+      flush();
+    }
+  }
+  void flush() {
+    ofs_.write(reinterpret_cast<const char*>(buffer_.data()), buffer_.size());
+    stream_size_ += buffer_.size();
+    buffer_.clear();
+  }
+
+  std::ofstream ofs_;
+  std::uint64_t num_knots_;
+  std::uint64_t checkpoint_interval_;
+  std::uint64_t num_steps_{};
+  std::uint64_t next_checkpoint_{};
+  std::uint64_t stream_size_{};
+  std::uint64_t num_checkpoints_{};
+  std::vector<std::uint64_t> checkpoints_{};
+  std::vector<std::uint8_t> buffer_{};
+  // The step being recorded
+  std::uint64_t moved_{};
+  std::vector<std::uint8_t> pending_{};
+  bool finished_{false};
 };
 
-constexpr const std::size_t num_knots{10};
+// Reads back a file written by `Recorder`, finding any knot's position at any
+// step by decoding forward from the last checkpoint at or before it
+class Replay {
+ public:
+  explicit Replay(const char* const path) : ifs_{path, std::ios::binary} {
+    Recorder::Header header{};
+    if (!ifs_.read(reinterpret_cast<char*>(&header), sizeof header) ||
+        header.magic != Recorder::magic || header.num_knots == 0) {
+      ifs_.close();
+      return;
+    }
+    num_knots_ = header.num_knots;
+    num_steps_ = header.num_steps;
+    checkpoints_.resize(header.num_checkpoints * (2 + num_knots_));
+    ifs_.seekg(sizeof header + header.stream_size);
+    if (!ifs_.read(reinterpret_cast<char*>(checkpoints_.data()),
+                   checkpoints_.size() * sizeof(std::uint64_t))) {
+      ifs_.close();
+    }
+  }
 
-std::tuple<End<Knot::Head>, std::array<End<Knot::Middle>, num_knots - 2>,
-           End<Knot::Tail>>
-make_rope() {
-  std::array<End<Knot::Middle>, num_knots - 2> middle;
-  middle.fill(End<Knot::Middle>{});
-  return std::make_tuple(End<Knot::Head>{}, middle, End<Knot::Tail>{});
-}
+  bool is_open() const { return ifs_.is_open(); }
+  std::size_t num_knots() const { return num_knots_; }
+  std::uint64_t num_steps() const { return num_steps_; }
+
+  // Where `knot` was after `step` steps, if the recording got that far
+  std::optional<Point> position(const std::size_t knot,
+                                const std::uint64_t step) {
+    if (knot >= num_knots_ || step > num_steps_ || checkpoints_.empty()) {
+      return {};
+    }
+    // The last checkpoint at or before `step`; the first is at step 0
+    const std::size_t stride = 2 + num_knots_;
+    std::size_t first{};
+    std::size_t last = checkpoints_.size() / stride;
+    while (last - first > 1) {
+      const std::size_t middle = first + (last - first) / 2;
+      (checkpoints_[middle * stride] <= step ? first : last) = middle;
+    }
+    const std::uint64_t* const checkpoint = &checkpoints_[first * stride];
+    std::uint64_t at = checkpoint[0];
+    Point point = std::bit_cast<Point>(checkpoint[2 + knot]);
+
+    ifs_.clear();
+    ifs_.seekg(sizeof(Recorder::Header) + checkpoint[1]);
+    std::vector<char> deltas;
+    while (at < step) {
+      const std::uint64_t moved = read_varint();
+      if (!ifs_) {
+        return {};
+      }
+      if (moved == 0) {
+        const std::uint64_t count = read_varint();
+        const Point offset = decode(static_cast<std::uint8_t>(ifs_.get()));
+        const std::int64_t reach =
+            static_cast<std::int64_t>(std::min(count, step - at));
+        point = {static_cast<std::int32_t>(point.x + offset.x * reach),
+                 static_cast<std::int32_t>(point.y + offset.y * reach)};
+        at += reach;
+        continue;
+      }
+      deltas.resize((moved + 1) / 2);
+      ifs_.read(deltas.data(), deltas.size());
+      if (knot < moved) {
+        const Point delta = decode(static_cast<std::uint8_t>(
+            static_cast<std::uint8_t>(deltas[knot / 2]) >> (knot % 2 * 4)));
+        point = {point.x + delta.x, point.y + delta.y};
+      }
+      ++at;
+    }
+    return point;
+  }
+
+ private:
+  static Point decode(const std::uint8_t signs) {
+    return {(signs & 0b11) - 1, ((signs >> 2) & 0b11) - 1};
+  }
+
+  std::uint64_t read_varint() {
+    std::uint64_t value{};
+    for (int shift{};; shift += 7) {
+      const int byte = ifs_.get();
+      if (byte == std::char_traits<char>::eof()) {
+        return value;
+      }
+      value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0) {
+        return value;
+      }
+    }
+  }
+
+  std::ifstream ifs_;
+  std::size_t num_knots_{};
+  std::uint64_t num_steps_{};
+  std::vector<std::uint64_t> checkpoints_{};
+};
+
+// A rope of any number of knots, the first of which is the head. The knots
+// listed in `tracked` record the points they visit; since no knot's path
+// depends on the knots behind it, knot `i` of a long rope walks exactly as
+// the tail of a rope of `i + 1` knots would.
+//
+// Likewise, once a knot stays put in a step, so does every knot behind it,
+// and the step ends there. The rope counts how many knot updates that skips.
+template <typename VisitSet = Visits::Dense>
+class Chain {
+ public:
+  struct Stats {
+    // Steps simulated knot by knot, rather than slid in closed form
+    std::uint64_t steps;
+    // Knot updates a step would make if it always followed through the rope
+    std::uint64_t knot_updates;
+    // Of those, the ones skipped because a knot ahead stayed put
+    std::uint64_t skipped_updates;
+  };
+
+  Chain(const std::size_t num_knots, const std::vector<std::size_t>& tracked)
+      : knots_(std::max<std::size_t>(num_knots, 1)),
+        slots_(knots_.size(), untracked) {
+    for (const std::size_t index : tracked) {
+      if (index < knots_.size() && slots_[index] == untracked) {
+        slots_[index] = visits_.size();
+        visits_.emplace_back(Point{});
+      }
+    }
+  }
+
+  std::size_t num_knots() const { return knots_.size(); }
+  const Point& knot(const std::size_t index) const { return knots_[index]; }
+  const Point& tail() const { return knots_.back(); }
+
+  const Stats& stats() const { return stats_; }
+
+  // Puts every knot back at the origin, forgetting their visits, so the
+  // rope can run a fresh set of motions in the memory it already has
+  void reset() {
+    std::fill(knots_.begin(), knots_.end(), Point{});
+    for (auto& visits : visits_) {
+      visits.clear(Point{});
+    }
+    stats_ = {};
+  }
+
+  // Records every step from now on to `recorder`, if not null
+  void set_recorder(Recorder* const recorder) { recorder_ = recorder; }
+
+  // Benchmarks may turn off the early exit to compare against
+  void set_early_exit(const bool early_exit) { early_exit_ = early_exit; }
+
+  // How many points knot `index`, which must be tracked, has visited
+  std::size_t num_visited(const std::size_t index) const {
+    return visits_[slots_[index]].size();
+  }
+
+  // Moves the head through `motion` a unit at a time, with the rest of the
+  // rope following. Once the rope lies straight behind the head, the
+  // remainder of the motion moves every knot the same distance at once.
+  void pull(const Motion& motion) {
+    const Point offset = unit_offset(motion.direction);
+    for (std::size_t step{}; step < motion.magnitude; ++step) {
+      const Point tail_before = tail();
+      if (recorder_ != nullptr) {
+        recorder_->begin_step(knots_);
+        recorder_->push(offset);
+      }
+      knots_.front().x += offset.x;
+      knots_.front().y += offset.y;
+      ++stats_.steps;
+      stats_.knot_updates += knots_.size() - 1;
+      for (std::size_t index{1}; index < knots_.size(); ++index) {
+        const Point next = follow_point(knots_[index], knots_[index - 1]);
+        if (early_exit_ && next == knots_[index]) {
+          // Revisiting a point adds nothing, so the tracked knots are done too
+          stats_.skipped_updates += knots_.size() - index;
+          break;
+        }
+        if (recorder_ != nullptr) {
+          recorder_->push({next.x - knots_[index].x, next.y - knots_[index].y});
+        }
+        knots_[index] = next;
+        if (slots_[index] != untracked) {
+          visits_[slots_[index]].insert(next);
+        }
+      }
+      if (recorder_ != nullptr) {
+        recorder_->end_step();
+      }
+
+      // Once the rope is straight the tail moves along with the head on
+      // every step, so only then is it worth checking
+      if (tail().x - tail_before.x == offset.x &&
+          tail().y - tail_before.y == offset.y && straightened(offset)) {
+        slide(offset, motion.magnitude - step - 1);
+        return;
+      }
+    }
+  }
+
+ private:
+  // Whether every knot trails the one ahead of it by exactly `offset`
+  bool straightened(const Point& offset) const {
+    for (std::size_t index{1}; index < knots_.size(); ++index) {
+      if (knots_[index - 1].x - knots_[index].x != offset.x ||
+          knots_[index - 1].y - knots_[index].y != offset.y) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Moves every knot `count` units by `offset` in a straight line
+  void slide(const Point& offset, const std::size_t count) {
+    if (recorder_ != nullptr && count > 0) {
+      recorder_->slide(knots_, offset, count);
+    }
+    for (std::size_t index{}; index < knots_.size(); ++index) {
+      if (slots_[index] != untracked) {
+        visits_[slots_[index]].insert_line(knots_[index], offset, count);
+      }
+    }
+    const std::int64_t reach = static_cast<std::int64_t>(count);
+    for (Point& knot : knots_) {
+      knot = {static_cast<std::int32_t>(knot.x + offset.x * reach),
+              static_cast<std::int32_t>(knot.y + offset.y * reach)};
+    }
+  }
+
+  static constexpr const std::size_t untracked{
+      std::numeric_limits<std::size_t>::max()};
+
+  std::vector<Point> knots_;
+  // Each knot's entry in `visits_`, or `untracked`
+  std::vector<std::size_t> slots_;
+  std::vector<VisitSet> visits_{};
+  bool early_exit_{true};
+  Stats stats_{};
+  Recorder* recorder_{nullptr};
+};
 }  // namespace Rope
 
-int main() {
+// Times a rope of `num_knots` knots through random motions totalling
+// `num_steps` steps, with and without the early exit, and checks that both
+// tails visit the same points
+bool run_benchmark(const std::size_t num_steps, const std::size_t num_knots) {
+  using Clock = std::chrono::steady_clock;
+  std::vector<Motion> motions;
+  {
+    constexpr const std::array<Motion::Direction, 4> directions{
+        Motion::Direction::up, Motion::Direction::down,
+        Motion::Direction::left, Motion::Direction::right};
+    std::mt19937 rng{num_steps};
+    std::uniform_int_distribution<std::size_t> direction{0, 3};
+    std::uniform_int_distribution<std::size_t> magnitude{1, 10};
+    for (std::size_t steps{}; steps < num_steps;) {
+      motions.emplace_back(directions[direction(rng)],
+                           std::min(magnitude(rng), num_steps - steps));
+      steps += motions.back().magnitude;
+    }
+  }
+
+  std::array<std::size_t, 2> num_visited{};
+  for (const bool early_exit : {true, false}) {
+    Rope::Chain<> rope{num_knots, {num_knots - 1}};
+    rope.set_early_exit(early_exit);
+    const auto start = Clock::now();
+    for (const auto& motion : motions) {
+      rope.pull(motion);
+    }
+    const double ms =
+        std::chrono::duration<double, std::milli>(Clock::now() - start)
+            .count();
+    const auto& stats = rope.stats();
+    std::cout << (early_exit ? "early exit: " : "full propagation: ") << ms
+              << " ms, " << stats.skipped_updates << " of "
+              << stats.knot_updates << " knot updates skipped ("
+              << 100.0 * stats.skipped_updates /
+                     std::max<std::uint64_t>(stats.knot_updates, 1)
+              << "%)\n";
+    num_visited[early_exit] = rope.num_visited(num_knots - 1);
+  }
+  const bool verified = num_visited[0] == num_visited[1];
+  std::cout << (verified ? "verified" : "MISMATCH") << '\n';
+  return verified;
+}
+
+// Times the visited sets on the tail of a two-knot rope through random
+// motions totalling `num_steps` steps, which drift up and to the right so the
+// walk spans a wide range
+bool run_visits_benchmark(const std::size_t num_steps) {
+  using Clock = std::chrono::steady_clock;
+  std::vector<Motion> motions;
+  {
+    constexpr const std::array<Motion::Direction, 6> directions{
+        Motion::Direction::up,   Motion::Direction::down,
+        Motion::Direction::left, Motion::Direction::right,
+        Motion::Direction::up,   Motion::Direction::right};
+    std::mt19937 rng{num_steps};
+    std::uniform_int_distribution<std::size_t> direction{0, 5};
+    std::uniform_int_distribution<std::size_t> magnitude{1, 10};
+    for (std::size_t steps{}; steps < num_steps;) {
+      motions.emplace_back(directions[direction(rng)],
+                           std::min(magnitude(rng), num_steps - steps));
+      steps += motions.back().magnitude;
+    }
+  }
+
+  std::array<std::size_t, 2> num_visited{};
+  const auto time = [&]<typename VisitSet>(const char* const name,
+                                           std::size_t& visited) {
+    const std::size_t heap_before = ::mallinfo2().uordblks;
+    Rope::Chain<VisitSet> rope{2, {1}};
+    const auto start = Clock::now();
+    for (const auto& motion : motions) {
+      rope.pull(motion);
+    }
+    visited = rope.num_visited(1);
+    const double ms =
+        std::chrono::duration<double, std::milli>(Clock::now() - start)
+            .count();
+    const std::size_t heap = ::mallinfo2().uordblks - heap_before;
+    std::cout << name << ": " << ms << " ms, " << visited << " points in "
+              << heap << " bytes (" << static_cast<double>(heap) / visited
+              << " per point)\n";
+  };
+  time.operator()<Rope::Visits::Tiled>("tiled", num_visited[0]);
+  time.operator()<Rope::Visits::Hashed>("unordered_set", num_visited[1]);
+  const bool verified = num_visited[0] == num_visited[1];
+  std::cout << (verified ? "verified" : "MISMATCH") << '\n';
+  return verified;
+}
+
+// Reads the run-length encoded motions of the file at `path` into `motions`.
+// Fails if the file can't be read or a line isn't a direction and a
+// magnitude.
+bool read_motions(const char* const path, std::vector<Motion>& motions) {
+  motions.clear();
+  std::ifstream ifs{path};
+  if (!ifs.is_open()) {
+    return false;
+  }
+  for (std::string line; std::getline(ifs, line);) {
+    if (line.empty()) {
+      continue;
+    }
+    // Index 0 is always direction and 1 is always a delimiter
+    std::size_t magnitude{};
+    if (line.size() < 3 ||
+        std::string_view{"UDLR"}.find(line[0]) == std::string_view::npos ||
+        line[1] != ' ' ||
+        std::from_chars(line.data() + 2, line.data() + line.size(), magnitude)
+                .ec != std::errc{}) {
+      return false;
+    }
+    motions.emplace_back(Motion::Direction{line[0]}, magnitude);
+  }
+  return true;
+}
+
+// Both parts come from one ten-knot rope, whose second knot is the tail of
+// the two-knot rope in part 1. Other lengths, `num_knots` of them or every
+// one up to `num_knots` with `all_lengths`, report their own counts instead.
+struct Report {
+  static constexpr const std::size_t puzzle_knots{10};
+
+  std::size_t num_knots;
+  bool all_lengths;
+
+  bool puzzle() const { return num_knots == 0; }
+  std::size_t rope_knots() const {
+    return puzzle() ? puzzle_knots : num_knots;
+  }
+  // The knots whose visits are reported, in the order they are
+  std::vector<std::size_t> tracked() const {
+    if (puzzle()) {
+      return {1, puzzle_knots - 1};
+    }
+    std::vector<std::size_t> knots;
+    for (std::size_t knot{all_lengths ? 1 : num_knots - 1}; knot < num_knots;
+         ++knot) {
+      knots.push_back(knot);
+    }
+    return knots;
+  }
+
+  // Runs `motions` through `rope` afresh and returns the counts to report
+  template <typename VisitSet>
+  std::vector<std::size_t> count(Rope::Chain<VisitSet>& rope,
+                                 const std::vector<Motion>& motions) const {
+    rope.reset();
+    for (const auto& motion : motions) {
+      rope.pull(motion);
+    }
+    std::vector<std::size_t> counts;
+    for (const std::size_t knot : tracked()) {
+      counts.push_back(rope.num_visited(knot));
+    }
+    return counts;
+  }
+
+  void print(const std::vector<std::size_t>& counts) const {
+    if (puzzle()) {
+      std::cout << "Problem 1: " << counts[0] << '\n';
+      std::cout << "Problem 2: " << counts[1] << '\n';
+      return;
+    }
+    const auto knots = tracked();
+    for (std::size_t index{}; index < counts.size(); ++index) {
+      std::cout << knots[index] + 1 << " knots: " << counts[index] << '\n';
+    }
+  }
+};
+
+// Simulates the input, recording every step to `record_path` if not null
+template <typename VisitSet>
+bool simulate(const Report& report, const char* const record_path,
+              const std::size_t checkpoint_interval) {
+  // Motions stay run-length encoded, and are only stepped through as they're
+  // simulated
   std::vector<Motion> motions;
-  if (std::ifstream ifs{"input"}; ifs.is_open()) {
-    for (std::string line; std::getline(ifs, line);) {
-      // Index 0 is always direction and 1 is always a delimiter
-      const Motion::Direction direction{line[0]};
-      const std::size_t magnitude = std::stoul(line.substr(2));
-      motions.insert(motions.end(), magnitude, Motion{direction});
+  if (!read_motions("input", motions)) {
+    return false;
+  }
+  Rope::Chain<VisitSet> rope{report.rope_knots(), report.tracked()};
+  std::optional<Rope::Recorder> recorder;
+  if (record_path != nullptr) {
+    recorder.emplace(record_path, rope.num_knots(), checkpoint_interval);
+    if (!recorder->is_open()) {
+      return false;
     }
+    rope.set_recorder(&*recorder);
   }
+  report.print(report.count(rope, motions));
+  return true;
+}
 
-  auto [head, middle, tail] = Rope::make_rope();
-  for (const auto& motion : motions) {
-    head.move(motion);
-    middle.begin()->follow(head);
-    for (auto it = std::next(middle.begin()); it != middle.end();
-         it = std::next(it)) {
-      it->follow(*std::prev(it));
+// Answers one query per line of standard input, each a knot and a step, with
+// where that knot was after that many steps of the recording at `path`
+bool replay(const char* const path) {
+  Rope::Replay replay{path};
+  if (!replay.is_open()) {
+    return false;
+  }
+  for (std::string line; std::getline(std::cin, line);) {
+    std::istringstream iss{line};
+    std::size_t knot{};
+    std::uint64_t step{};
+    if (!(iss >> knot >> step)) {
+      continue;
+    }
+    std::cout << "knot " << knot << " at step " << step << ": ";
+    if (const auto point = replay.position(knot, step)) {
+      std::cout << *point << '\n';
+    } else {
+      std::cout << "not recorded\n";
     }
-    tail.follow(*std::prev(middle.end()));
   }
+  return true;
+}
 
-  std::cout << "Problem 2: " << tail.points_visited().size() << '\n';
+// Simulates every motion file in `paths` on `num_threads` threads, which
+// claim files from a shared counter. Each thread keeps one rope and motion
+// buffer that it reuses from file to file, so a file whose walk fits in the
+// memory kept from earlier ones allocates little beyond its stream and its
+// counts. Once all are done, every file's counts print on one line, in the
+// order given.
+template <typename VisitSet>
+bool simulate_batch(const Report& report,
+                    const std::vector<const char*>& paths,
+                    const std::size_t num_threads) {
+  std::vector<std::optional<std::vector<std::size_t>>> results(paths.size());
+  std::atomic<std::size_t> next{};
+  const auto work = [&] {
+    std::vector<Motion> motions;
+    Rope::Chain<VisitSet> rope{report.rope_knots(), report.tracked()};
+    for (std::size_t index = next++; index < paths.size(); index = next++) {
+      if (read_motions(paths[index], motions)) {
+        results[index] = report.count(rope, motions);
+      }
+    }
+  };
+  std::vector<std::thread> threads;
+  for (std::size_t thread{1}; thread < num_threads; ++thread) {
+    threads.emplace_back(work);
+  }
+  work();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  bool all_read{true};
+  for (std::size_t index{}; index < paths.size(); ++index) {
+    std::cout << paths[index] << ':';
+    if (!results[index]) {
+      std::cout << " unreadable\n";
+      all_read = false;
+      continue;
+    }
+    for (const std::size_t count : *results[index]) {
+      std::cout << ' ' << count;
+    }
+    std::cout << '\n';
+  }
+  return all_read;
+}
+
+int main(int argc, char* argv[]) {
+  // `--knots N` simulates a rope of N knots instead of answering the puzzle,
+  // and `--all-lengths` also reports every shorter rope from the same pass.
+  // `--bench STEPS` times a rope of N knots (1000 by default) through STEPS
+  // random steps instead. `--sparse` records visits in tiles rather than over
+  // the whole bounding box, for walks that drift far, and `--bench-visits
+  // STEPS` times those tiles against a hash set. `--batch FILE...` simulates
+  // every given motion file instead of the input, on `--threads N` threads
+  // (one per core by default). `--record PATH` writes the input's every step
+  // to PATH, with the positions of all knots every `--checkpoint-every N`
+  // steps (4096 by default), and `--replay PATH` answers "knot step" queries
+  // against such a recording.
+  std::size_t num_knots{};
+  bool all_lengths{false};
+  bool sparse{false};
+  std::size_t bench_steps{};
+  std::size_t bench_visits_steps{};
+  std::size_t num_threads{std::max(1u, std::thread::hardware_concurrency())};
+  std::vector<const char*> batch_paths;
+  bool batch{false};
+  const char* record_path{nullptr};
+  std::size_t checkpoint_interval{4096};
+  const char* replay_path{nullptr};
+  for (int arg{1}; arg < argc; ++arg) {
+    const std::string_view option{argv[arg]};
+    if (option == "--knots" && arg + 1 < argc) {
+      num_knots = std::max<std::size_t>(2, std::stoul(argv[++arg]));
+    } else if (option == "--all-lengths") {
+      all_lengths = true;
+    } else if (option == "--sparse") {
+      sparse = true;
+    } else if (option == "--bench" && arg + 1 < argc) {
+      bench_steps = std::stoul(argv[++arg]);
+    } else if (option == "--bench-visits" && arg + 1 < argc) {
+      bench_visits_steps = std::stoul(argv[++arg]);
+    } else if (option == "--threads" && arg + 1 < argc) {
+      num_threads = std::max<std::size_t>(1, std::stoul(argv[++arg]));
+    } else if (option == "--record" && arg + 1 < argc) {
+      record_path = argv[++arg];
+    } else if (option == "--checkpoint-every" && arg + 1 < argc) {
+      checkpoint_interval = std::stoul(argv[++arg]);
+    } else if (option == "--replay" && arg + 1 < argc) {
+      replay_path = argv[++arg];
+    } else if (option == "--batch") {
+      batch = true;
+    } else if (batch) {
+      batch_paths.push_back(argv[arg]);
+    }
+  }
+
+  if (bench_steps > 0) {
+    constexpr const std::size_t bench_knots{1000};
+    return run_benchmark(bench_steps, num_knots > 0 ? num_knots : bench_knots)
+               ? 0
+               : 1;
+  }
+  if (bench_visits_steps > 0) {
+    return run_visits_benchmark(bench_visits_steps) ? 0 : 1;
+  }
+  if (replay_path != nullptr) {
+    return replay(replay_path) ? 0 : 1;
+  }
+
+  const Report report{num_knots, all_lengths};
+  bool ok{};
+  if (batch) {
+    ok = sparse ? simulate_batch<Rope::Visits::Tiled>(report, batch_paths,
+                                                      num_threads)
+                : simulate_batch<Rope::Visits::Dense>(report, batch_paths,
+                                                      num_threads);
+  } else {
+    ok = sparse ? simulate<Rope::Visits::Tiled>(report, record_path,
+                                                checkpoint_interval)
+                : simulate<Rope::Visits::Dense>(report, record_path,
+                                                checkpoint_interval);
+  }
+  return ok ? 0 : 1;
 }
 
 // 2651
@@ -1 +1 @@
-find . -iname *.cpp -o -iname *.hpp -o -path ./build -o -path ./8/include -prune | xargs clang-format -i --style=Google --verbose
+find . -iname *.cpp -o -iname *.hpp -o -path ./build -prune | xargs clang-format -i --style=Google --verbose